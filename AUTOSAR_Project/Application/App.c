@@ -13,8 +13,18 @@
 #include "ECUAL/Button/Button.h"
 #include "ECUAL/Led/Led.h"
 #include "MCAL/Dio/Dio.h"
-#include "MCAL/Mcu/Mcu.h"
+#include "MCAL/EEP/Eep.h"
+#include "MCAL/GPT/Gpt.h"
+#include "MCAL/ICU/Icu.h"
+#include "MCAL/IRQ/Irq.h"
+#include "MCAL/MCU/Mcu.h"
 #include "MCAL/Port/Port.h"
+#include "MCAL/PWM/Pwm.h"
+#include "MCAL/UART/Uart.h"
+#include "Services_Layer/Development_Error_Tracer/Det.h"
+#include "Services_Layer/Event_Queue/Event_Queue.h"
+#include "Services_Layer/Fault_Log/FaultLog.h"
+#include "Services_Layer/Software_Timer/SwTimer.h"
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
@@ -22,14 +32,45 @@ void Init_Task(void)
     /* Initialize Mcu Driver */
     Mcu_Init();
 
+    /* Move the vector table to the SRAM so the drivers can install their interrupt handlers */
+    Irq_Init();
+
+    /* Start the 64-bit timestamp time base */
+    Gpt_TimestampInit();
+
+    /* Start recording the development errors of the drivers */
+    Det_Init();
+
+    /* Initialize the EEPROM Driver and find the newest block of the stored fault log */
+    Eep_Init();
+    FaultLog_Init();
+
     /* Initialize Port Driver */
     Port_Init(Port_PinsConfigurations);
 
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
+
+    /* Start the PWM channels of the LEDs, the LED pins stay Dio until a LED is dimmed */
+    Pwm_Init();
+
+    /* Turn the LEDs OFF and start their shadow state */
+    Led_Init();
+
+    /* Configure the edge detection of SW1, its notification is enabled by the Button Module */
+    Icu_Init();
+
+    /* Initialize UART0 for the binary trace stream, PA1 is set to UART0 TX by the Port Driver */
+    Uart_Init();
+
+    /* Initialize the Software Timers */
+    SwTimer_Init();
+
+    /* Initialize the Button Module, it uses a software timer in the edge interrupt mode */
+    Button_Init();
 }
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds to check the button state (activated by the edges in the edge interrupt mode) */
 void Button_Task(void)
 {
     Button_RefreshState();
@@ -41,20 +82,36 @@ void Led_Task(void)
     Led_RefreshOutput();
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/*
+ * Description: Task executes every 60 Mili-seconds (activated by the button events in the edge interrupt mode)
+ *              to consume the button events: each SW1 press toggles LED1, a long press starts the heartbeat
+ *              pattern on LED3 (green) and a double click stops it
+ */
 void App_Task(void)
 {
-    static uint8 button_previous_state = BUTTON_RELEASED;
-    static uint8 button_current_state  = BUTTON_RELEASED;
-
-    button_current_state = Button_GetState(); /* Read the button state */
+    EventQueue_EventType event;
 
-    /* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */ 
-    if((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+    while(E_OK == EventQueue_Pop(BUTTON_EVENTS_QUEUE_ID, &event))
     {
-        Led_Toggle();
+        if(ButtonConf_SW1_ID != event.Param)
+        {
+            /* No Action Required */
+        }
+        else if(BUTTON_EVENT_PRESSED == event.Event_Id)
+        {
+            Led_Toggle(LedConf_LED1_ID);
+        }
+        else if(BUTTON_EVENT_LONG_PRESS == event.Event_Id)
+        {
+            Led_PlayPattern(LedConf_LED3_ID, LedConf_HEARTBEAT_PATTERN_ID);
+        }
+        else if(BUTTON_EVENT_DOUBLE_CLICK == event.Event_Id)
+        {
+            Led_StopPattern(LedConf_LED3_ID);
+        }
+        else
+        {
+            /* No Action Required */
+        }
     }
-
-    button_previous_state = button_current_state;
 }
@@ -17,13 +17,13 @@
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void);
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds to check the button state (activated by the edges in the edge interrupt mode) */
 void Button_Task(void);
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led (activated by the button events in the edge interrupt mode) */
 void App_Task(void);
 
 #endif /* APP_H_ */
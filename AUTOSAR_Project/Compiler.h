@@ -51,4 +51,18 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/* This is used to run a function from the SRAM (.TI.ramfunc section), ResetISR copies it from the flash */
+#if defined(HOST_SIM)
+#define FUNC_RAM
+#else
+#define FUNC_RAM          __attribute__((section(".TI.ramfunc")))
+#endif
+
+/* This is used to order the memory accesses before and after it (data shared with the interrupts) */
+#if defined(HOST_SIM)
+#define MEMORY_BARRIER()  __sync_synchronize()
+#else
+#define MEMORY_BARRIER()  __asm(" DMB")
+#endif
+
 #endif
@@ -6,25 +6,158 @@
  *
  * Description: Source file for Button Module.
  *
+ *              Vertical counters: bit n of Count0 and Count1 is a 2-bit counter of the consecutive
+ *              samples of pin n that differ from its debounced state, so the 8 pins of a port are
+ *              counted together with a few bitwise operations and one Dio_ReadPort per port.
+ *              A pin changes its state on the 3rd differing sample (60 ms at 20 ms), a sample equal
+ *              to the state clears its counter.
+ *
+ *              Edge interrupt mode: no periodic sampling. The first edge masks the edge interrupts of
+ *              all the buttons and activates the Button Task, which starts the one-shot settle timer.
+ *              The timer expiry activates the Button Task again: it unmasks the edges (discarding the
+ *              bounces latched while masked) then samples the ports once, so an edge after the sample
+ *              always starts a new settle window.
+ *
+ *              Gesture engine: after the debouncing, a small state machine per configured button turns
+ *              its debounced state into press, release, long press, double click and repeat events
+ *              stamped with the Gpt time in ms. Each button costs a few compares per call: the long
+ *              press and the repeat compare the time with their deadline and the double click is only
+ *              decided at the press edge from the time of the previous release. The events are pushed
+ *              to the button events queue. In the edge interrupt mode a periodic timer activates the
+ *              Button Task only while a held button still waits for a long press or a repeat.
+ *
  * Author: Bassam Ashraf
  ******************************************************************************/
-#include "MCAL/Dio/Dio.h"
+
 #include "Button.h"
 
+/* Interrupts lock of the edges read-and-clear, the refresh task may preempt the reader */
+#include "Services_Layer/Scheduler/Os.h"
+
+/* Timers of the edge interrupt mode and the button events queue */
+#include "Services_Layer/Software_Timer/SwTimer.h"
+#include "Services_Layer/Event_Queue/Event_Queue.h"
+
+#if defined(HOST_SIM)
+/* Host simulation build, the events are counted by BUTTON_EVENT_HOOK */
+#include "Simulation/Sim.h"
+#endif
+
+/* Time stamps of the button events */
+#include "MCAL/GPT/Gpt.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Debouncing data of one port, one bit per pin */
+typedef struct
+{
+    Dio_PortLevelType State;        /* Debounced state, 1 = pressed */
+    Dio_PortLevelType Count0;       /* Counter bit 0 */
+    Dio_PortLevelType Count1;       /* Counter bit 1 */
+    Dio_PortLevelType Pressed;      /* Edges since the last Button_GetPortEvents */
+    Dio_PortLevelType Released;
+}Button_PortDataType;
+
+/* Description: Gesture data of one button, the times are in ms */
+typedef struct
+{
+    uint32 Press_Time;              /* Time of the last press */
+    uint32 Release_Time;            /* Time of the last release */
+    uint32 Next_Repeat;             /* Time of the next repeat event while held */
+    boolean Pressed;                /* State seen by the previous call */
+    boolean Long_Reported;          /* The long press of this press was reported */
+    boolean Double_Clicked;         /* This press ended a double click */
+    boolean Click_Pending;          /* The last release ended a short press, the next press may be a double click */
+}Button_GestureDataType;
+
 /*******************************************************************************
  *                  Special Global variable for "Button.c" only                *
  *******************************************************************************/
 
-static uint8 g_button_state = BUTTON_RELEASED;
+static Button_PortDataType g_Button_Ports[BUTTON_NUMBER_OF_PORTS];
+
+static Button_GestureDataType g_Button_Gestures[BUTTON_NUMBER_OF_BUTTONS];
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+/* Set by the edge notification, the Button Task starts the settle timer */
+static volatile boolean g_Button_Edge_Detected = FALSE;
+
+/* The settle timer was started and its expiry was not processed yet */
+static boolean g_Button_Settling = FALSE;
+
+/* Set by Button_PushEvent, the events consumer is activated at the end of Button_ProcessGestures */
+static boolean g_Button_Events_Pushed = FALSE;
+
+/* Set by Button_ProcessGestures while a held button waits for a long press or a repeat */
+static boolean g_Button_Gesture_Waiting = FALSE;
+#endif
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+static void Button_SettleExpired(void);
+#endif
+
+static void Button_ProcessGestures(void);
+
+static void Button_PushEvent(uint16 EventId, uint8 ButtonId, uint32 Time);
 
 /*******************************************************************************
  *                          Function definitions                               *
  *******************************************************************************/
 
+/*
+ * Description: Clear the debounced states (all released), in the edge interrupt mode start the settle timer
+ *              to take the first states, the edge interrupts are enabled when it expires. Called after SwTimer_Init.
+ */
+void Button_Init(void)
+{
+    uint8 index = 0;
+
+    for(index = 0; index < BUTTON_NUMBER_OF_PORTS; index++)
+    {
+        g_Button_Ports[index].State    = 0;
+        g_Button_Ports[index].Count0   = 0;
+        g_Button_Ports[index].Count1   = 0;
+        g_Button_Ports[index].Pressed  = 0;
+        g_Button_Ports[index].Released = 0;
+    }
+    for(index = 0; index < BUTTON_NUMBER_OF_BUTTONS; index++)
+    {
+        g_Button_Gestures[index].Pressed        = FALSE;
+        g_Button_Gestures[index].Long_Reported  = FALSE;
+        g_Button_Gestures[index].Double_Clicked = FALSE;
+        g_Button_Gestures[index].Click_Pending  = FALSE;
+    }
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+    /* A button held at start up is reported after the first window as in the polling mode */
+    g_Button_Edge_Detected = FALSE;
+    g_Button_Settling      = TRUE;
+    (void)SwTimer_Start(BUTTON_SETTLE_TIMER_ID, BUTTON_SETTLE_TIME_MS, 0U);
+#endif
+}
+
+/************************************************************************************************************/
+
 /* Description: Read the Button state Pressed/Released */
 uint8 Button_GetState(void)
 {
-    return g_button_state;
+    uint8 state = BUTTON_RELEASED;
+
+    if(BIT_IS_SET(g_Button_Ports[BUTTON_PORT_INDEX].State, BUTTON_PIN_NUM))
+    {
+        state = BUTTON_PRESSED;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return state;
 }
 
 /************************************************************************************************************/
@@ -33,41 +166,310 @@ uint8 Button_GetState(void)
  * Description: This function is called every 20ms by OS Task and it responsible for Updating
  *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
  *              and it should be in a RELEASED State if the button is released for 60ms.
+ *              All the pins of the configured ports are debounced the same way from one read per port.
+ *              In the edge interrupt mode it is called when an edge is detected, to start the settle timer,
+ *              when the settle timer expires, to take the sampled states, and by the gesture timer.
+ *              The gesture events of the buttons are pushed to the button events queue at the end.
  */
-
 void Button_RefreshState(void)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+    if(TRUE == g_Button_Edge_Detected)
+    {
+        g_Button_Edge_Detected = FALSE;
+        g_Button_Settling      = TRUE;
+
+        /* The SwTimer task has a higher priority, it must not process the wheel while the timer is linked */
+        Os_SuspendAllInterrupts();
+        (void)SwTimer_Start(BUTTON_SETTLE_TIMER_ID, BUTTON_SETTLE_TIME_MS, 0U);
+        Os_ResumeAllInterrupts();
+    }
+    else if((TRUE == g_Button_Settling) && (FALSE == SwTimer_IsRunning(BUTTON_SETTLE_TIMER_ID)))
+    {
+        g_Button_Settling = FALSE;
+        Button_SettleExpired();
+    }
+    else
+    {
+        /* Gesture tick or activated again during the settle window, the states are not sampled */
+    }
+#else
+    const Button_PortConfigType * Config_Ptr = NULL_PTR;
+    Button_PortDataType * Port_Ptr = NULL_PTR;
+    Dio_PortLevelType differ = 0;
+    Dio_PortLevelType toggle = 0;
+    uint8 index = 0;
+
+    for(index = 0; index < BUTTON_NUMBER_OF_PORTS; index++)
+    {
+        Config_Ptr = &Button_PortsConfigurations[index];
+        Port_Ptr   = &g_Button_Ports[index];
+
+        /* The sample is 1 for a pressed pin, the pins that agree with their state clear their counters */
+        differ = ((Dio_ReadPort(Config_Ptr->Port_Num) ^ Config_Ptr->Active_Low) & Config_Ptr->Mask) ^ Port_Ptr->State;
 
-    /* Count the number of Pressed times increment if the switch pressed for 20 ms */
-    static uint8 g_Pressed_Count  = 0;
+        /* Increment the counters of the differing pins (Count1 uses the old Count0) */
+        Port_Ptr->Count1 = (Port_Ptr->Count1 ^ Port_Ptr->Count0) & differ;
+        Port_Ptr->Count0 = (Dio_PortLevelType)(~Port_Ptr->Count0) & differ;
 
-    /* Count the number of Released times increment if the switch released for 20 ms */
-    static uint8 g_Released_Count = 0;
+        /* The pins reaching the count of 3 take the sampled state */
+        toggle = Port_Ptr->Count0 & Port_Ptr->Count1;
+        Port_Ptr->State  ^= toggle;
+        Port_Ptr->Count0 &= (Dio_PortLevelType)~toggle;
+        Port_Ptr->Count1 &= (Dio_PortLevelType)~toggle;
+
+        Port_Ptr->Pressed  |= toggle & Port_Ptr->State;
+        Port_Ptr->Released |= toggle & (Dio_PortLevelType)~Port_Ptr->State;
+    }
+#endif
+
+    Button_ProcessGestures();
+}
+
+/************************************************************************************************************/
+
+/* Description: ICU notification of the button edges (interrupt context), mask the edges and activate the Button Task */
+void Button_EdgeNotification(void)
+{
+    uint8 index = 0;
 
-    if(state == BUTTON_PRESSED)
+    /* The bounces of the settle window are latched by the hardware but do not interrupt */
+    for(index = 0; index < BUTTON_NUMBER_OF_PORTS; index++)
     {
-        g_Pressed_Count++;
-        g_Released_Count = 0;
+        Icu_DisableNotification(Button_PortsConfigurations[index].Icu_Channel);
+    }
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+    g_Button_Edge_Detected = TRUE;
+    (void)Os_ActivateTask(OsConf_BUTTON_TASK_ID);
+#endif
+}
+
+/************************************************************************************************************/
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+/* Description: End of the settle window, unmask the edges then take the sampled states */
+static void Button_SettleExpired(void)
+{
+    const Button_PortConfigType * Config_Ptr = NULL_PTR;
+    Button_PortDataType * Port_Ptr = NULL_PTR;
+    Dio_PortLevelType sample = 0;
+    Dio_PortLevelType toggle = 0;
+    uint8 index = 0;
+
+    for(index = 0; index < BUTTON_NUMBER_OF_PORTS; index++)
+    {
+        Config_Ptr = &Button_PortsConfigurations[index];
+        Port_Ptr   = &g_Button_Ports[index];
+
+        /* Unmasked before the sample, an edge between them is not lost as it starts a new window */
+        Icu_EnableNotification(Config_Ptr->Icu_Channel);
+        sample = (Dio_ReadPort(Config_Ptr->Port_Num) ^ Config_Ptr->Active_Low) & Config_Ptr->Mask;
+        toggle = sample ^ Port_Ptr->State;
+        Port_Ptr->State = sample;
+
+        Port_Ptr->Pressed  |= toggle & sample;
+        Port_Ptr->Released |= toggle & (Dio_PortLevelType)~sample;
+    }
+}
+#endif
+
+/************************************************************************************************************/
+
+/*
+ * Description: Run the gesture state machine of every button on its debounced state and push its events,
+ *              in the edge interrupt mode run the gesture timer while a held button waits for a deadline.
+ */
+static void Button_ProcessGestures(void)
+{
+    const Button_ConfigType * Config_Ptr = NULL_PTR;
+    Button_GestureDataType * Gesture_Ptr = NULL_PTR;
+    uint32 now = (uint32)Gpt_TimestampToMs(Gpt_GetTimestamp());
+    boolean pressed = FALSE;
+    uint8 ButtonId = 0;
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+    g_Button_Events_Pushed   = FALSE;
+    g_Button_Gesture_Waiting = FALSE;
+#endif
+
+    for(ButtonId = 0; ButtonId < BUTTON_NUMBER_OF_BUTTONS; ButtonId++)
+    {
+        Config_Ptr  = &Button_Configurations[ButtonId];
+        Gesture_Ptr = &g_Button_Gestures[ButtonId];
+        pressed = (BIT_IS_SET(g_Button_Ports[Config_Ptr->Port_Index].State, Config_Ptr->Pin_Num)) ? TRUE : FALSE;
+
+        if(pressed != Gesture_Ptr->Pressed)
+        {
+            Gesture_Ptr->Pressed = pressed;
+            if(TRUE == pressed)
+            {
+                Button_PushEvent(BUTTON_EVENT_PRESSED, ButtonId, now);
+
+                /* The unsigned subtraction gives the time since the release even if the ms time wrapped around */
+                Gesture_Ptr->Double_Clicked = FALSE;
+                if((TRUE == Gesture_Ptr->Click_Pending) && ((now - Gesture_Ptr->Release_Time) <= Config_Ptr->Double_Click_Time))
+                {
+                    Button_PushEvent(BUTTON_EVENT_DOUBLE_CLICK, ButtonId, now);
+                    Gesture_Ptr->Double_Clicked = TRUE;
+                }
+                else
+                {
+                    /* No Action Required */
+                }
+                Gesture_Ptr->Press_Time    = now;
+                Gesture_Ptr->Next_Repeat   = now + Config_Ptr->Repeat_Delay;
+                Gesture_Ptr->Long_Reported = FALSE;
+            }
+            else
+            {
+                Button_PushEvent(BUTTON_EVENT_RELEASED, ButtonId, now);
+
+                /* A long press or the second click of a double click can not start a new double click */
+                Gesture_Ptr->Click_Pending = ((0 != Config_Ptr->Double_Click_Time) && (FALSE == Gesture_Ptr->Long_Reported)
+                                              && (FALSE == Gesture_Ptr->Double_Clicked)) ? TRUE : FALSE;
+                Gesture_Ptr->Release_Time  = now;
+            }
+        }
+        else if(TRUE == pressed)
+        {
+            if((0 != Config_Ptr->Long_Press_Time) && (FALSE == Gesture_Ptr->Long_Reported)
+               && ((now - Gesture_Ptr->Press_Time) >= Config_Ptr->Long_Press_Time))
+            {
+                Button_PushEvent(BUTTON_EVENT_LONG_PRESS, ButtonId, now);
+                Gesture_Ptr->Long_Reported = TRUE;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+            /* The signed difference keeps the deadline check correct when the ms time wraps around */
+            if((0 != Config_Ptr->Repeat_Delay) && ((sint32)(now - Gesture_Ptr->Next_Repeat) >= 0))
+            {
+                Button_PushEvent(BUTTON_EVENT_REPEAT, ButtonId, now);
+                Gesture_Ptr->Next_Repeat += Config_Ptr->Repeat_Period;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+        else
+        {
+            /* Released, the double click is decided by the next press */
+        }
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+        if((TRUE == pressed) && ((0 != Config_Ptr->Repeat_Delay)
+           || ((0 != Config_Ptr->Long_Press_Time) && (FALSE == Gesture_Ptr->Long_Reported))))
+        {
+            g_Button_Gesture_Waiting = TRUE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+#endif
+    }
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+    /* The SwTimer task has a higher priority, it must not process the wheel while the timer is linked */
+    Os_SuspendAllInterrupts();
+    if(g_Button_Gesture_Waiting != SwTimer_IsRunning(BUTTON_GESTURE_TIMER_ID))
+    {
+        if(TRUE == g_Button_Gesture_Waiting)
+        {
+            (void)SwTimer_Start(BUTTON_GESTURE_TIMER_ID, OS_BASE_TIME, OS_BASE_TIME);
+        }
+        else
+        {
+            SwTimer_Stop(BUTTON_GESTURE_TIMER_ID);
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    Os_ResumeAllInterrupts();
+
+    /* The consumer is activated once for all the events of this call */
+    if(TRUE == g_Button_Events_Pushed)
+    {
+        (void)Os_ActivateTask(BUTTON_EVENTS_TASK_ID);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+}
+
+/************************************************************************************************************/
+
+/* Description: Push one event of a button to the button events queue, it is dropped and counted if the queue is full */
+static void Button_PushEvent(uint16 EventId, uint8 ButtonId, uint32 Time)
+{
+    EventQueue_EventType event;
+
+    BUTTON_EVENT_HOOK(EventId, ButtonId);
+
+    event.Event_Id = EventId;
+    event.Param    = ButtonId;
+    event.Data     = Time;
+    (void)EventQueue_Push(BUTTON_EVENTS_QUEUE_ID, &event);
+
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+    g_Button_Events_Pushed = TRUE;
+#endif
+}
+
+/************************************************************************************************************/
+
+/* Description: Return the debounced pressed pins of a configured port (bit set = pressed), 0 for an invalid port */
+Dio_PortLevelType Button_GetPortState(uint8 PortIndex)
+{
+    Dio_PortLevelType state = 0;
+
+    if(PortIndex < BUTTON_NUMBER_OF_PORTS)
+    {
+        state = g_Button_Ports[PortIndex].State;
     }
     else
     {
-        g_Released_Count++;
-        g_Pressed_Count = 0;
+        /* No Action Required */
     }
+    return state;
+}
 
-    if(g_Pressed_Count == 3)
+/************************************************************************************************************/
+
+/*
+ * Description: Copy the pins pressed, released and changed since the previous call for the same port to Events_Ptr
+ *              and clear them, return E_NOT_OK for an invalid port.
+ */
+Std_ReturnType Button_GetPortEvents(uint8 PortIndex, Button_PortEventsType * Events_Ptr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((PortIndex < BUTTON_NUMBER_OF_PORTS) && (NULL_PTR != Events_Ptr))
     {
-        g_button_state = BUTTON_PRESSED;
-        g_Pressed_Count       = 0;
-        g_Released_Count      = 0;
+        Os_SuspendAllInterrupts();
+        Events_Ptr->Pressed  = g_Button_Ports[PortIndex].Pressed;
+        Events_Ptr->Released = g_Button_Ports[PortIndex].Released;
+        g_Button_Ports[PortIndex].Pressed  = 0;
+        g_Button_Ports[PortIndex].Released = 0;
+        Os_ResumeAllInterrupts();
+
+        /* A pin pressed then released (or the opposite) between two calls is set in both masks */
+        Events_Ptr->Changed = Events_Ptr->Pressed | Events_Ptr->Released;
+        ret = E_OK;
     }
-    else if(g_Released_Count == 3)
+    else
     {
-        g_button_state = BUTTON_RELEASED;
-        g_Released_Count      = 0;
-        g_Pressed_Count       = 0;
+        /* No Action Required */
     }
+    return ret;
 }
 
 /************************************************************************************************************/
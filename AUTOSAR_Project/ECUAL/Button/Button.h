@@ -8,22 +8,111 @@
  *
  * Author: Bassam Ashraf
  ******************************************************************************/
+
 #ifndef BUTTON_H
 #define BUTTON_H
 
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/ICU/Icu.h"
 #include "Button_Cfg.h"
 
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
 
-/* Description: Read the Button state Pressed/Released */
-uint8 Button_GetState(void);
+/* Event IDs pushed to the button events queue, Param is the button ID and Data the time of the event in ms (Gpt time) */
+#define BUTTON_EVENT_PRESSED                (uint16)0x0001
+#define BUTTON_EVENT_RELEASED               (uint16)0x0002
+#define BUTTON_EVENT_LONG_PRESS             (uint16)0x0003  /* Held for Long_Press_Time, once per press */
+#define BUTTON_EVENT_DOUBLE_CLICK           (uint16)0x0004  /* Pushed after the PRESSED event of the second click */
+#define BUTTON_EVENT_REPEAT                 (uint16)0x0005  /* Held for Repeat_Delay, then every Repeat_Period */
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
 
+/* Description: Structure to configure each debounced port:
+ *  1. The Dio port read once per refresh.
+ *  2. Mask of the debounced pins.
+ *  3. Mask of the active low pins (pressed when they read low).
+ *  4. The ICU channel of the pins used in the edge interrupt mode.
+ */
+typedef struct
+{
+    Dio_PortType Port_Num;
+    Dio_PortLevelType Mask;
+    Dio_PortLevelType Active_Low;
+    Icu_ChannelType Icu_Channel;
+}Button_PortConfigType;
 
+/* Description: Structure to configure the gestures of each button, the times are in ms and 0 disables the event:
+ *  1. Index of its port in Button_PortsConfigurations.
+ *  2. Pin number in the port (one of the debounced pins).
+ *  3. Hold time of the long press event.
+ *  4. Maximum time from the release of a short press to the next press for the double click event.
+ *  5. Hold time of the first repeat event.
+ *  6. Period of the next repeat events (MUST not be 0 if the repeat is enabled).
+ */
+typedef struct
+{
+    uint8 Port_Index;
+    uint8 Pin_Num;
+    uint16 Long_Press_Time;
+    uint16 Double_Click_Time;
+    uint16 Repeat_Delay;
+    uint16 Repeat_Period;
+}Button_ConfigType;
+
+/* Description: Debounced edges of the pins of a port, one bit per pin */
+typedef struct
+{
+    Dio_PortLevelType Pressed;
+    Dio_PortLevelType Released;
+    Dio_PortLevelType Changed;
+}Button_PortEventsType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/*
+ * Description: Clear the debounced states (all released), in the edge interrupt mode start the settle timer
+ *              to take the first states, the edge interrupts are enabled when it expires. Called after SwTimer_Init.
+ */
+void Button_Init(void);
+
+/* Description: Read the Button state Pressed/Released */
+uint8 Button_GetState(void);
 
 /* 
  * Description: This function is called every 20ms by OS Task and it responsible for Updating
  *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
  *		        and it should be in a RELEASED State if the button is released for 60ms.
+ *              All the pins of the configured ports are debounced the same way from one read per port.
+ *              In the edge interrupt mode it is called when an edge is detected, to start the settle timer,
+ *              when the settle timer expires, to take the sampled states, and by the gesture timer.
+ *              The gesture events of the buttons are pushed to the button events queue at the end.
  */   
 void Button_RefreshState(void);
 
+/* Description: ICU notification of the button edges (interrupt context), mask the edges and activate the Button Task */
+void Button_EdgeNotification(void);
+
+/* Description: Return the debounced pressed pins of a configured port (bit set = pressed), 0 for an invalid port */
+Dio_PortLevelType Button_GetPortState(uint8 PortIndex);
+
+/*
+ * Description: Copy the pins pressed, released and changed since the previous call for the same port to Events_Ptr
+ *              and clear them, return E_NOT_OK for an invalid port.
+ */
+Std_ReturnType Button_GetPortEvents(uint8 PortIndex, Button_PortEventsType * Events_Ptr);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Button */
+extern const Button_PortConfigType Button_PortsConfigurations[BUTTON_NUMBER_OF_PORTS];
+extern const Button_ConfigType Button_Configurations[BUTTON_NUMBER_OF_BUTTONS];
+
 #endif /* BUTTON_H */
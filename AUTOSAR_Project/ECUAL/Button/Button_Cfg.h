@@ -22,5 +22,58 @@
 /* Set the Button Pin Number */
 #define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
 
+/* Number of the debounced ports in the array of structures in Button_PBcfg.c */
+#define BUTTON_NUMBER_OF_PORTS              (1U)
+
+/* Port Index in the array of structures in Button_PBcfg.c */
+#define ButtonConf_PORTF_INDEX              (uint8)0x00
+
+/* Port Index of the Button Port */
+#define BUTTON_PORT_INDEX ButtonConf_PORTF_INDEX
+
+/* Number of the buttons in the gestures array of structures in Button_PBcfg.c */
+#define BUTTON_NUMBER_OF_BUTTONS            (1U)
+
+/* Button ID in the gestures array of structures in Button_PBcfg.c, it is the Param of its events */
+#define ButtonConf_SW1_ID                   (uint8)0x00
+
+/*
+ * Pre-compile option for the edge interrupt mode, when it is ON the Button Task is not periodic:
+ * the first edge of a button masks the edge interrupts of all the buttons and starts the settle
+ * timer, the pins take their sampled state when it expires and the changes are pushed to the
+ * button events queue for the App Task. When it is OFF the ports are sampled every 20 ms.
+ * It can be given on the compiler command line to build the host simulation in both modes.
+ */
+#ifndef BUTTON_EDGE_INTERRUPT_MODE
+#define BUTTON_EDGE_INTERRUPT_MODE          (STD_OFF)
+#endif
+
+/*
+ * Settle time in ms after the first edge, it is rounded up to the Os tick and counted from the last
+ * Os tick (Os_GetTickCount, not the last tick processed by the SwTimer task) so the pins are sampled (BUTTON_SETTLE_TIME_MS - OS_BASE_TIME) to BUTTON_SETTLE_TIME_MS
+ * after the edge, 60 ms filters the same bounces as the 3 samples of the polling mode.
+ */
+#define BUTTON_SETTLE_TIME_MS               (60U)
+
+/* The one-shot settle timer, it activates the Button Task on expiry */
+#define BUTTON_SETTLE_TIMER_ID              SwTimerConf_BUTTON_SETTLE_TIMER_ID
+
+/* Periodic timer activating the Button Task while a held button waits for a long press or a repeat (edge interrupt mode) */
+#define BUTTON_GESTURE_TIMER_ID             SwTimerConf_BUTTON_GESTURE_TIMER_ID
+
+/* The queue of the button events and the task activated when events are pushed (edge interrupt mode) */
+#define BUTTON_EVENTS_QUEUE_ID              EventQueueConf_BUTTON_EVENTS_QUEUE_ID
+#define BUTTON_EVENTS_TASK_ID               OsConf_APP_TASK_ID
+
+/*
+ * Hook called with each event of the gesture engine before it is pushed to the queue, in the host
+ * simulation it counts the events for the checks of the gesture traces.
+ */
+#if defined(HOST_SIM)
+#define BUTTON_EVENT_HOOK(EventId, ButtonId)    Sim_ButtonEventHook(EventId, ButtonId)
+#else
+#define BUTTON_EVENT_HOOK(EventId, ButtonId)
+#endif
+
 
 #endif /* BUTTON_CFG_H_ */
@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ * Module: Button
+ *
+ * File Name: Button_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for Button Module.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "Button.h"
+
+/* Array of structure that hold the debounced ports each structure include:
+ * 1. The Dio port read once per refresh.
+ * 2. Mask of the debounced pins, the other pins of the port are ignored.
+ * 3. Mask of the active low pins (pressed when they read low, pull up buttons).
+ * 4. The ICU channel detecting the edges of the pins in the edge interrupt mode. */
+const Button_PortConfigType Button_PortsConfigurations[BUTTON_NUMBER_OF_PORTS] =
+{
+     { BUTTON_PORT, (Dio_PortLevelType)(1U << BUTTON_PIN_NUM),
+       (BUTTON_PRESSED == STD_LOW) ? (Dio_PortLevelType)(1U << BUTTON_PIN_NUM) : 0U,
+       IcuConf_SW1_CHANNEL_ID }                                                               /* PORTF: SW1 */
+};
+
+/* Array of structure that hold the gestures of each button:
+ * 1. Index of the button port in Button_PortsConfigurations.
+ * 2. Pin number of the button.
+ * 3. Long press hold time in ms.
+ * 4. Double click time in ms (release to next press).
+ * 5. Auto-repeat delay and period in ms. */
+const Button_ConfigType Button_Configurations[BUTTON_NUMBER_OF_BUTTONS] =
+{
+     { ButtonConf_PORTF_INDEX, BUTTON_PIN_NUM, 1000U, 300U, 500U, 200U }   /* SW1 */
+};
@@ -6,45 +6,691 @@
  *
  * Description: Source file for Led Module.
  *
+ *              The intended level of the LED pins of each port is kept in a RAM shadow, the
+ *              set, clear and toggle APIs update the shadow and write the changed pin with one
+ *              masked store (no read of the port). The refresh reads each port once and only
+ *              rewrites the pins that differ from the shadow, in one masked store per port.
+ *
+ *              The port levels of the 8 colors of each RGB LED are computed once by Led_Init,
+ *              a color change is one table read and one masked store of the three pins so the
+ *              LED never shows an intermediate color.
+ *
+ *              Pattern engine: each playing LED keeps its step and the Os tick of its next step.
+ *              Hashed wheel per port: the pin of a playing LED is set in the wheel slot of its due
+ *              tick modulo LED_PATTERN_WHEEL_SIZE, so each slot is the pin mask of the LEDs that may
+ *              step in that tick. The pattern tick reads one slot per port, a port with an empty
+ *              slot costs one compare whatever its number of LEDs. Only the LEDs of the slot are
+ *              visited, the ones due in a later turn of the wheel are skipped by comparing their
+ *              due tick, and the due LEDs move to their next step and slot and have all their pins
+ *              written in one masked store. Play and stop are O(1) (one slot bit).
+ *
+ *              PWM dimming: a LED with a PWM channel is switched to it by Port_SetPinMode for the
+ *              levels between OFF and LED_LEVEL_MAX, the hardware then drives the pin with no CPU
+ *              time. Its shadow bit is kept at the ON level and the refresh skips it. Any write of
+ *              the pin by the shadow switches it back to Dio after the store, so the pin shows the
+ *              new level as soon as the PWM channel releases it. The dimmed LEDs due in a pattern
+ *              tick are staged and applied in the same PWM period.
+ *
  * Author: Bassam Ashraf
  ******************************************************************************/
 
-#include "MCAL/Dio/Dio.h"
 #include "Led.h"
+#include "Services_Layer/Scheduler/Os.h"
+#include "Services_Layer/Software_Timer/SwTimer.h"
+
+#if (PORT_SET_PIN_MODE_API != STD_ON)
+#error "The Led Module needs Port_SetPinMode to switch the LED pins to their PWM channels"
+#endif
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* End of the LEDs list of a port */
+#define LED_INVALID_ID                      (Led_IdType)0xFF
+
+/* Number of the pins of a port (bits of Dio_PortLevelType) */
+#define LED_PINS_PER_PORT                   (8U)
+
+#define LED_WHEEL_SLOT_MASK                 (LED_PATTERN_WHEEL_SIZE - 1U)
+
+#if ((LED_PATTERN_WHEEL_SIZE == 0) || ((LED_PATTERN_WHEEL_SIZE & (LED_PATTERN_WHEEL_SIZE - 1)) != 0))
+#error "LED_PATTERN_WHEEL_SIZE must be a power of 2"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Pattern state of one LED */
+typedef struct
+{
+    const Led_PatternType * Pattern_Ptr;    /* NULL_PTR if the LED plays no pattern */
+    uint32 Due_Tick;                        /* Os tick of the next step */
+    uint8 Step;
+    Led_IdType Next_In_Port;                /* Next LED of the same port (used to release the PWM pins) */
+}Led_PatternStateType;
+
+/*******************************************************************************
+ *                  Special Global variable for "Led.c" only                   *
+ *******************************************************************************/
+
+/* Intended level of the LED pins of each port (the bits out of the port Pins_Mask are always 0) */
+static Dio_PortLevelType g_Led_Shadow[LED_NUMBER_OF_PORTS];
+
+/* Port levels of the three pins of each RGB LED for each color, and the mask of the three pins */
+static Dio_PortLevelType g_Led_Rgb_Levels[LED_NUMBER_OF_RGB_LEDS][LED_NUMBER_OF_COLORS];
+static Dio_PortLevelType g_Led_Rgb_Mask[LED_NUMBER_OF_RGB_LEDS];
+
+/* LED pins of each port driven by their PWM channel */
+static Dio_PortLevelType g_Led_Pwm_Pins[LED_NUMBER_OF_PORTS];
+
+/* Number of the LED pins corrected by the refresh */
+static uint32 g_Led_Glitch_Count = 0;
+
+/* Pattern state of each LED and the first LED of each port */
+static Led_PatternStateType g_Led_Pattern_States[LED_NUMBER_OF_LEDS];
+static Led_IdType g_Led_First_In_Port[LED_NUMBER_OF_PORTS];
+
+/* Pins of the playing LEDs of each port in the wheel slot of their next step, and the LED of each pin */
+static Dio_PortLevelType g_Led_Wheel[LED_NUMBER_OF_PORTS][LED_PATTERN_WHEEL_SIZE];
+static Led_IdType g_Led_Pin_Led[LED_NUMBER_OF_PORTS][LED_PINS_PER_PORT];
+
+/* The last Os tick processed by the pattern tick, every tick after it is processed so no slot is missed */
+static uint32 g_Led_Pattern_Tick = 0;
+
+/* Number of the playing LEDs */
+static uint8 g_Led_Playing = 0;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static Dio_PortLevelType Led_PinLevel(Led_IdType LedId, boolean On);
+
+static void Led_WritePins(uint8 PortIndex, Dio_PortLevelType PinsMask, Dio_PortLevelType Levels);
+
+static boolean Led_IsDimmed(Led_IdType LedId, uint8 Level);
+
+static void Led_StageDimming(Led_IdType LedId, uint8 Level);
+
+static void Led_SetLevel(Led_IdType LedId, uint8 Level);
+
+static void Led_ReleasePwmPins(uint8 PortIndex, Dio_PortLevelType PinsMask);
+
+static void Led_EndPattern(Led_IdType LedId);
+
+static uint32 Led_StepTicks(const Led_PatternStepType * Step_Ptr);
+
+static void Led_PatternPort(uint8 PortIndex, uint32 Tick);
 
 /*******************************************************************************
  *                          Function definitions                               *
  *******************************************************************************/
 
+/* Description: Set all the LEDs to OFF, the shadow and the pins */
+void Led_Init(void)
+{
+    const Led_RgbConfigType * Rgb_Ptr = NULL_PTR;
+    Led_IdType LedId = 0;
+    Led_ColorType Color = 0;
+    uint8 PortIndex = 0;
+    uint8 Index = 0;
+
+    for(PortIndex = 0; PortIndex < LED_NUMBER_OF_PORTS; PortIndex++)
+    {
+        g_Led_Shadow[PortIndex]        = 0;
+        g_Led_Pwm_Pins[PortIndex]      = 0;    /* Port_Init sets the LED pins to Dio */
+        g_Led_First_In_Port[PortIndex] = LED_INVALID_ID;
+        for(Index = 0; Index < LED_PATTERN_WHEEL_SIZE; Index++)
+        {
+            g_Led_Wheel[PortIndex][Index] = 0;
+        }
+        for(Index = 0; Index < LED_PINS_PER_PORT; Index++)
+        {
+            g_Led_Pin_Led[PortIndex][Index] = LED_INVALID_ID;
+        }
+    }
+    /* The LEDs are linked in the lists of their ports backwards so each list is in the table order */
+    for(LedId = LED_NUMBER_OF_LEDS; LedId > 0; LedId--)
+    {
+        PortIndex = Led_Configurations[LedId - 1U].Port_Index;
+        g_Led_Shadow[PortIndex] |= Led_PinLevel(LedId - 1U, FALSE);
+        g_Led_Pattern_States[LedId - 1U].Pattern_Ptr  = NULL_PTR;
+        g_Led_Pattern_States[LedId - 1U].Next_In_Port = g_Led_First_In_Port[PortIndex];
+        g_Led_First_In_Port[PortIndex] = LedId - 1U;
+        g_Led_Pin_Led[PortIndex][Led_Configurations[LedId - 1U].Pin_Num] = LedId - 1U;
+    }
+    g_Led_Playing = 0;
+
+    for(LedId = 0; LedId < LED_NUMBER_OF_RGB_LEDS; LedId++)
+    {
+        Rgb_Ptr = &Led_RgbConfigurations[LedId];
+        g_Led_Rgb_Mask[LedId] = (Dio_PortLevelType)((1U << Led_Configurations[Rgb_Ptr->Red_Led].Pin_Num)
+                                                    | (1U << Led_Configurations[Rgb_Ptr->Green_Led].Pin_Num)
+                                                    | (1U << Led_Configurations[Rgb_Ptr->Blue_Led].Pin_Num));
+        for(Color = 0; Color < LED_NUMBER_OF_COLORS; Color++)
+        {
+            g_Led_Rgb_Levels[LedId][Color] = (Dio_PortLevelType)(Led_PinLevel(Rgb_Ptr->Red_Led, BIT_IS_SET(Color, 0))
+                                                                 | Led_PinLevel(Rgb_Ptr->Green_Led, BIT_IS_SET(Color, 1))
+                                                                 | Led_PinLevel(Rgb_Ptr->Blue_Led, BIT_IS_SET(Color, 2)));
+        }
+    }
+
+    for(PortIndex = 0; PortIndex < LED_NUMBER_OF_PORTS; PortIndex++)
+    {
+        Dio_MaskedWritePort(Led_PortsConfigurations[PortIndex].Port_Num, g_Led_Shadow[PortIndex],
+                            Led_PortsConfigurations[PortIndex].Pins_Mask);
+    }
+    g_Led_Glitch_Count = 0;
+}
+
+/************************************************************************************************************/
+
 /* Description: Set the LED state to ON */
-void Led_SetOn(void)
+void Led_SetOn(Led_IdType LedId)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    if(LedId < LED_NUMBER_OF_LEDS)
+    {
+        Os_SuspendAllInterrupts();
+        Led_EndPattern(LedId);
+        Led_WritePins(Led_Configurations[LedId].Port_Index, (Dio_PortLevelType)(1U << Led_Configurations[LedId].Pin_Num),
+                      Led_PinLevel(LedId, TRUE));      /* LED ON */
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
 }
 
 /************************************************************************************************************/
 
 /* Description: Set the LED state to OFF */
-void Led_SetOff(void)
+void Led_SetOff(Led_IdType LedId)
+{
+    if(LedId < LED_NUMBER_OF_LEDS)
+    {
+        Os_SuspendAllInterrupts();
+        Led_EndPattern(LedId);
+        Led_WritePins(Led_Configurations[LedId].Port_Index, (Dio_PortLevelType)(1U << Led_Configurations[LedId].Pin_Num),
+                      Led_PinLevel(LedId, FALSE));     /* LED OFF */
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************************************/
+
+/*Description: Toggle the LED state, a dimmed LED is turned OFF */
+void Led_Toggle(Led_IdType LedId)
+{
+    uint8 PortIndex = 0;
+    Dio_PortLevelType PinMask = 0;
+
+    if(LedId < LED_NUMBER_OF_LEDS)
+    {
+        PortIndex = Led_Configurations[LedId].Port_Index;
+        PinMask   = (Dio_PortLevelType)(1U << Led_Configurations[LedId].Pin_Num);
+
+        /* The shadow is flipped and written in the same critical section so a refresh never sees half of it */
+        Os_SuspendAllInterrupts();
+        Led_EndPattern(LedId);
+        Led_WritePins(PortIndex, PinMask, (Dio_PortLevelType)~g_Led_Shadow[PortIndex]);
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************************************/
+
+/*
+ * Description: Set the brightness of a LED from 0 (OFF) to LED_LEVEL_MAX, the pin is switched to its PWM
+ *              channel for the levels in between and back to Dio for OFF and LED_LEVEL_MAX. The dimming
+ *              is done by the PWM hardware, it costs no CPU time until the next level change.
+ */
+void Led_SetBrightness(Led_IdType LedId, uint8 Level)
+{
+    if((LedId < LED_NUMBER_OF_LEDS) && (Level <= LED_LEVEL_MAX))
+    {
+        Os_SuspendAllInterrupts();
+        Led_EndPattern(LedId);
+        Led_SetLevel(LedId, Level);
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************************************/
+
+/* Description: Set the color of an RGB LED, its three pins change together in one masked store */
+void Led_SetColor(Led_IdType RgbId, Led_ColorType Color)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    if((RgbId < LED_NUMBER_OF_RGB_LEDS) && (Color < LED_NUMBER_OF_COLORS))
+    {
+        Os_SuspendAllInterrupts();
+        Led_EndPattern(Led_RgbConfigurations[RgbId].Red_Led);
+        Led_EndPattern(Led_RgbConfigurations[RgbId].Green_Led);
+        Led_EndPattern(Led_RgbConfigurations[RgbId].Blue_Led);
+        Led_WritePins(Led_Configurations[Led_RgbConfigurations[RgbId].Red_Led].Port_Index, g_Led_Rgb_Mask[RgbId],
+                      g_Led_Rgb_Levels[RgbId][Color]);
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
 }
 
 /************************************************************************************************************/
 
-/*Description: Toggle the LED state */
-void Led_Toggle(void)
+/*
+ * Description: Play a pattern on a LED from its first step, the LED takes the level of the step now.
+ *              Led_SetOn, Led_SetOff, Led_Toggle, Led_SetBrightness and Led_SetColor stop the pattern of their LEDs.
+ */
+void Led_PlayPattern(Led_IdType LedId, Led_PatternIdType PatternId)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    Led_PatternStateType * State_Ptr = NULL_PTR;
+    uint8 PortIndex = 0;
+
+    if((LedId < LED_NUMBER_OF_LEDS) && (PatternId < LED_NUMBER_OF_PATTERNS) && (0 != Led_Patterns[PatternId].Number_Of_Steps))
+    {
+        State_Ptr = &g_Led_Pattern_States[LedId];
+        PortIndex = Led_Configurations[LedId].Port_Index;
+
+        /* The pattern tick runs in the software timers task, it never sees a half started pattern */
+        Os_SuspendAllInterrupts();
+        Led_EndPattern(LedId);
+        State_Ptr->Pattern_Ptr = &Led_Patterns[PatternId];
+        State_Ptr->Step        = 0;
+        State_Ptr->Due_Tick    = Os_GetTickCount() + Led_StepTicks(&State_Ptr->Pattern_Ptr->Steps_Ptr[0]);
+        g_Led_Wheel[PortIndex][State_Ptr->Due_Tick & LED_WHEEL_SLOT_MASK] |= (Dio_PortLevelType)(1U << Led_Configurations[LedId].Pin_Num);
+        g_Led_Playing++;
+
+        Led_SetLevel(LedId, State_Ptr->Pattern_Ptr->Steps_Ptr[0].Level);
+
+        if(FALSE == SwTimer_IsRunning(LED_PATTERN_TIMER_ID))
+        {
+            /* The ticks before this one have no LED in the wheel */
+            g_Led_Pattern_Tick = Os_GetTickCount();
+            (void)SwTimer_Start(LED_PATTERN_TIMER_ID, LED_PATTERN_TICK_MS, LED_PATTERN_TICK_MS);
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
 }
 
 /************************************************************************************************************/
 
-/* Description: Refresh the LED state */
+/* Description: Stop the pattern of a LED and set it OFF, nothing is done if it plays no pattern */
+void Led_StopPattern(Led_IdType LedId)
+{
+    if((LedId < LED_NUMBER_OF_LEDS) && (NULL_PTR != g_Led_Pattern_States[LedId].Pattern_Ptr))
+    {
+        Led_SetOff(LedId);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************************************/
+
+/*
+ * Description: Pattern tick called by the periodic pattern timer every LED_PATTERN_TICK_MS, it processes each Os tick
+ *              since its last call (one when the pattern tick is the Os tick), only visits the ports with LEDs in the
+ *              wheel slot of the tick and writes the changed pins of each port in one masked store.
+ */
+void Led_PatternMainFunction(void)
+{
+    uint32 Tick = Os_GetTickCount();
+    uint8 PortIndex = 0;
+
+    while(g_Led_Pattern_Tick != Tick)
+    {
+        g_Led_Pattern_Tick++;
+        for(PortIndex = 0; PortIndex < LED_NUMBER_OF_PORTS; PortIndex++)
+        {
+            if(0 != g_Led_Wheel[PortIndex][g_Led_Pattern_Tick & LED_WHEEL_SLOT_MASK])
+            {
+                Os_SuspendAllInterrupts();
+                Led_PatternPort(PortIndex, g_Led_Pattern_Tick);
+                Os_ResumeAllInterrupts();
+            }
+            else
+            {
+                /* No LED may step in this port */
+            }
+        }
+    }
+
+    /* The timer only runs while a LED plays a pattern, Led_PlayPattern starts it again */
+    Os_SuspendAllInterrupts();
+    if(0 == g_Led_Playing)
+    {
+        SwTimer_Stop(LED_PATTERN_TIMER_ID);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    Os_ResumeAllInterrupts();
+}
+
+/************************************************************************************************************/
+
+/*
+ * Description: Rewrite the LED pins whose level differs from the shadow state, one read and at most one store per port.
+ *              The pins driven by their PWM channel are not checked.
+ */
 void Led_RefreshOutput(void)
 {
-    Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* Re-write the same value */
+    const Led_PortConfigType * Port_Ptr = NULL_PTR;
+    Dio_PortLevelType wrong_pins = 0;
+    uint8 PortIndex = 0;
+
+    for(PortIndex = 0; PortIndex < LED_NUMBER_OF_PORTS; PortIndex++)
+    {
+        Port_Ptr = &Led_PortsConfigurations[PortIndex];
+
+        /* A set, clear or toggle can not run between the read and the correction */
+        Os_SuspendAllInterrupts();
+        wrong_pins = (Dio_PortLevelType)((Dio_ReadPort(Port_Ptr->Port_Num) ^ g_Led_Shadow[PortIndex])
+                                         & Port_Ptr->Pins_Mask & ~g_Led_Pwm_Pins[PortIndex]);
+        if(0 != wrong_pins)
+        {
+            Dio_MaskedWritePort(Port_Ptr->Port_Num, g_Led_Shadow[PortIndex], wrong_pins);
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Os_ResumeAllInterrupts();
+
+        /* Count the corrected pins, one iteration per set bit */
+        while(0 != wrong_pins)
+        {
+            wrong_pins &= (Dio_PortLevelType)(wrong_pins - 1U);
+            g_Led_Glitch_Count++;
+        }
+    }
+}
+
+/************************************************************************************************************/
+
+/* Description: Return the number of the LED pins found with a wrong level and corrected by Led_RefreshOutput */
+uint32 Led_GetGlitchCount(void)
+{
+    return g_Led_Glitch_Count;
+}
+
+/************************************************************************************************************/
+
+/* Description: Return the port level of the LED pin (its bit set for a high level) to turn it ON or OFF */
+static Dio_PortLevelType Led_PinLevel(Led_IdType LedId, boolean On)
+{
+    Dio_PortLevelType level = 0;
+
+    /* The pin is high for a positive logic LED turned ON or a negative logic LED turned OFF */
+    if(((STD_HIGH == Led_Configurations[LedId].On_Level) && (FALSE != On))
+       || ((STD_LOW == Led_Configurations[LedId].On_Level) && (FALSE == On)))
+    {
+        level = (Dio_PortLevelType)(1U << Led_Configurations[LedId].Pin_Num);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return level;
+}
+
+/************************************************************************************************************/
+
+/*
+ * Description: Set the levels of the masked pins of a LED port in the shadow and write them with one masked store,
+ *              the dimmed pins are then switched back to Dio
+ */
+static void Led_WritePins(uint8 PortIndex, Dio_PortLevelType PinsMask, Dio_PortLevelType Levels)
+{
+    Os_SuspendAllInterrupts();
+    g_Led_Shadow[PortIndex] = (Dio_PortLevelType)((g_Led_Shadow[PortIndex] & ~PinsMask) | (Levels & PinsMask));
+    Dio_MaskedWritePort(Led_PortsConfigurations[PortIndex].Port_Num, g_Led_Shadow[PortIndex], PinsMask);
+    if(0 != (g_Led_Pwm_Pins[PortIndex] & PinsMask))
+    {
+        Led_ReleasePwmPins(PortIndex, PinsMask);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    Os_ResumeAllInterrupts();
+}
+
+/************************************************************************************************************/
+
+/* Description: Return TRUE if the level of the LED is produced by its PWM channel */
+static boolean Led_IsDimmed(Led_IdType LedId, uint8 Level)
+{
+    return (boolean)((LED_NO_PWM_CHANNEL != Led_Configurations[LedId].Pwm_Channel)
+                     && (0U != Level) && (Level < LED_LEVEL_MAX));
+}
+
+/************************************************************************************************************/
+
+/*
+ * Description: Stage the duty cycle of a dimmed LED and route its PWM channel to the pin, the caller applies the
+ *              PWM updates and holds the interrupts disabled
+ */
+static void Led_StageDimming(Led_IdType LedId, uint8 Level)
+{
+    const Led_ConfigType * Led_Ptr = &Led_Configurations[LedId];
+    Dio_PortLevelType PinMask = (Dio_PortLevelType)(1U << Led_Ptr->Pin_Num);
+
+    Pwm_StageDutyCycle(Led_Ptr->Pwm_Channel, (uint16)(((uint32)Level * PWM_DUTY_MAX) / LED_LEVEL_MAX));
+
+    /* A dimmed LED is ON for the toggle, the pin itself is left to the PWM channel */
+    g_Led_Shadow[Led_Ptr->Port_Index] = (Dio_PortLevelType)((g_Led_Shadow[Led_Ptr->Port_Index] & ~PinMask)
+                                                            | Led_PinLevel(LedId, TRUE));
+    if(0 == (g_Led_Pwm_Pins[Led_Ptr->Port_Index] & PinMask))
+    {
+        Port_SetPinMode(Led_Ptr->Port_Pin, Led_Ptr->Pwm_Mode);
+        g_Led_Pwm_Pins[Led_Ptr->Port_Index] |= PinMask;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************************************/
+
+/* Description: Set the level of one LED by its PWM channel or by its Dio pin, the caller holds the interrupts disabled */
+static void Led_SetLevel(Led_IdType LedId, uint8 Level)
+{
+    if(TRUE == Led_IsDimmed(LedId, Level))
+    {
+        Led_StageDimming(LedId, Level);
+        Pwm_ApplyUpdates();
+    }
+    else
+    {
+        Led_WritePins(Led_Configurations[LedId].Port_Index, (Dio_PortLevelType)(1U << Led_Configurations[LedId].Pin_Num),
+                      Led_PinLevel(LedId, (boolean)(0U != Level)));
+    }
+}
+
+/************************************************************************************************************/
+
+/* Description: Switch the dimmed pins in the mask of a LED port back to Dio, the caller holds the interrupts disabled */
+static void Led_ReleasePwmPins(uint8 PortIndex, Dio_PortLevelType PinsMask)
+{
+    Led_IdType LedId = g_Led_First_In_Port[PortIndex];
+    Dio_PortLevelType PinMask = 0;
+
+    while(LED_INVALID_ID != LedId)
+    {
+        PinMask = (Dio_PortLevelType)(1U << Led_Configurations[LedId].Pin_Num);
+        if(0 != (g_Led_Pwm_Pins[PortIndex] & PinsMask & PinMask))
+        {
+            Port_SetPinMode(Led_Configurations[LedId].Port_Pin, PORT_PIN_MODE_DIO);
+            g_Led_Pwm_Pins[PortIndex] &= (Dio_PortLevelType)~PinMask;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        LedId = g_Led_Pattern_States[LedId].Next_In_Port;
+    }
+}
+
+/************************************************************************************************************/
+
+/* Description: Stop the pattern of a LED without changing its pin, the caller holds the interrupts disabled */
+static void Led_EndPattern(Led_IdType LedId)
+{
+    if(NULL_PTR != g_Led_Pattern_States[LedId].Pattern_Ptr)
+    {
+        g_Led_Wheel[Led_Configurations[LedId].Port_Index][g_Led_Pattern_States[LedId].Due_Tick & LED_WHEEL_SLOT_MASK]
+            &= (Dio_PortLevelType)~(1U << Led_Configurations[LedId].Pin_Num);
+        g_Led_Pattern_States[LedId].Pattern_Ptr = NULL_PTR;
+        g_Led_Playing--;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************************************/
+
+/* Description: Return the number of the Os ticks of a step, at least one */
+static uint32 Led_StepTicks(const Led_PatternStepType * Step_Ptr)
+{
+    uint32 ticks = ((uint32)Step_Ptr->Time_Ms + OS_BASE_TIME - 1U) / OS_BASE_TIME;
+
+    if(0 == ticks)
+    {
+        ticks = 1;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ticks;
+}
+
+/************************************************************************************************************/
+
+/*
+ * Description: Move the due LEDs in the wheel slot of the tick of a port to their next step and slot, write their pins
+ *              in one masked store (the dimmed LEDs in one PWM update), the caller holds the interrupts disabled
+ */
+static void Led_PatternPort(uint8 PortIndex, uint32 Tick)
+{
+    Led_PatternStateType * State_Ptr = NULL_PTR;
+    Dio_PortLevelType * Slot_Ptr = &g_Led_Wheel[PortIndex][Tick & LED_WHEEL_SLOT_MASK];
+    Dio_PortLevelType SlotPins = *Slot_Ptr;
+    Dio_PortLevelType PinMask = 0;
+    Dio_PortLevelType PinsMask = 0;
+    Dio_PortLevelType Levels = 0;
+    Led_IdType LedId = 0;
+    uint8 Pin = 0;
+    uint8 Level = 0;
+    boolean dimmed_found = FALSE;
+
+    /* The LEDs moved to the same slot by this tick (a step of LED_PATTERN_WHEEL_SIZE ticks) are not in SlotPins */
+    for(Pin = 0; 0 != SlotPins; Pin++)
+    {
+        PinMask = (Dio_PortLevelType)(1U << Pin);
+        LedId   = g_Led_Pin_Led[PortIndex][Pin];
+        if(0 == (SlotPins & PinMask))
+        {
+            /* No LED of the slot on this pin */
+        }
+        else if((sint32)(Tick - g_Led_Pattern_States[LedId].Due_Tick) >= 0)
+        {
+            SlotPins &= (Dio_PortLevelType)~PinMask;
+            State_Ptr = &g_Led_Pattern_States[LedId];
+            *Slot_Ptr &= (Dio_PortLevelType)~PinMask;
+            State_Ptr->Step++;
+            if(State_Ptr->Step < State_Ptr->Pattern_Ptr->Number_Of_Steps)
+            {
+                Level = State_Ptr->Pattern_Ptr->Steps_Ptr[State_Ptr->Step].Level;
+            }
+            else if(TRUE == State_Ptr->Pattern_Ptr->Repeat)
+            {
+                State_Ptr->Step = 0;
+                Level = State_Ptr->Pattern_Ptr->Steps_Ptr[0].Level;
+            }
+            else
+            {
+                /* One-shot pattern, the LED ends OFF */
+                Led_EndPattern(LedId);
+                Level = 0;
+            }
+
+            if(NULL_PTR != State_Ptr->Pattern_Ptr)
+            {
+                /* The next step is relative to the due tick so the pattern does not drift */
+                State_Ptr->Due_Tick += Led_StepTicks(&State_Ptr->Pattern_Ptr->Steps_Ptr[State_Ptr->Step]);
+                g_Led_Wheel[PortIndex][State_Ptr->Due_Tick & LED_WHEEL_SLOT_MASK] |= PinMask;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+            if(TRUE == Led_IsDimmed(LedId, Level))
+            {
+                Led_StageDimming(LedId, Level);
+                dimmed_found = TRUE;
+            }
+            else
+            {
+                PinsMask |= PinMask;
+                Levels   |= Led_PinLevel(LedId, (boolean)(0U != Level));
+            }
+        }
+        else
+        {
+            /* Due in a later turn of the wheel */
+            SlotPins &= (Dio_PortLevelType)~PinMask;
+        }
+    }
+
+    if(FALSE != dimmed_found)
+    {
+        Pwm_ApplyUpdates();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    if(0 != PinsMask)
+    {
+        Led_WritePins(PortIndex, PinsMask, Levels);
+    }
+    else
+    {
+        /* No Action Required */
+    }
 }
 
 /************************************************************************************************************/
@@ -11,21 +11,176 @@
 #ifndef LED_H
 #define LED_H
 
+#include "MCAL/Dio/Dio.h"
+#include "MCAL/Port/Port.h"
+#include "MCAL/PWM/Pwm.h"
 #include "Led_Cfg.h"
 
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Colors of an RGB LED, bit 0 is red, bit 1 green and bit 2 blue */
+#define LED_COLOR_OFF                       (Led_ColorType)0x00
+#define LED_COLOR_RED                       (Led_ColorType)0x01
+#define LED_COLOR_GREEN                     (Led_ColorType)0x02
+#define LED_COLOR_YELLOW                    (Led_ColorType)0x03
+#define LED_COLOR_BLUE                      (Led_ColorType)0x04
+#define LED_COLOR_MAGENTA                   (Led_ColorType)0x05
+#define LED_COLOR_CYAN                      (Led_ColorType)0x06
+#define LED_COLOR_WHITE                     (Led_ColorType)0x07
+
+/* Number of the colors of an RGB LED */
+#define LED_NUMBER_OF_COLORS                (8U)
+
+/*
+ * Highest brightness level in %, the levels between 0 and LED_LEVEL_MAX are produced by the PWM channel
+ * of the LED. A LED without PWM channel is ON for any level above 0.
+ */
+#define LED_LEVEL_MAX                       (uint8)100
+
+/* PWM channel field of a LED without PWM channel */
+#define LED_NO_PWM_CHANNEL                  (Pwm_ChannelType)0xFF
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Led_IdType used by the Led APIs (index in the LEDs or the RGB LEDs table) */
+typedef uint8 Led_IdType;
+
+/* Type definition for Led_ColorType used by the RGB LED APIs (LED_COLOR_xxx) */
+typedef uint8 Led_ColorType;
+
+/* Type definition for Led_PatternIdType used by the pattern APIs (index in the patterns table) */
+typedef uint8 Led_PatternIdType;
+
+/* Description: Structure to configure each LED port:
+ *  1. The Dio port written with masked stores.
+ *  2. Mask of the LED pins, the refresh only checks these pins.
+ */
+typedef struct
+{
+    Dio_PortType Port_Num;
+    Dio_PortLevelType Pins_Mask;
+}Led_PortConfigType;
+
+/* Description: Structure to configure each LED:
+ *  1. Index of the LED port in Led_PortsConfigurations.
+ *  2. Pin number of the LED.
+ *  3. Pin level turning the LED ON (STD_HIGH or STD_LOW).
+ *  4. PWM channel dimming the LED (LED_NO_PWM_CHANNEL for none), its polarity MUST be the ON level.
+ *  5. Port pin ID of the LED and the pin mode routing the PWM channel to the pin.
+ */
+typedef struct
+{
+    uint8 Port_Index;
+    uint8 Pin_Num;
+    Dio_LevelType On_Level;
+    Pwm_ChannelType Pwm_Channel;
+    Port_PinType Port_Pin;
+    Port_PinModeType Pwm_Mode;
+}Led_ConfigType;
+
+/* Description: Structure to configure each RGB LED from three LEDs of the same port:
+ *  1. ID of the red, green and blue LEDs in Led_Configurations.
+ */
+typedef struct
+{
+    Led_IdType Red_Led;
+    Led_IdType Green_Led;
+    Led_IdType Blue_Led;
+}Led_RgbConfigType;
+
+/* Description: Structure of one step of a pattern:
+ *  1. Brightness level of the LED from 0 (OFF) to LED_LEVEL_MAX.
+ *  2. Time of the step in ms, rounded up to the Os tick (at least one tick).
+ */
+typedef struct
+{
+    uint8 Level;
+    uint16 Time_Ms;
+}Led_PatternStepType;
+
+/* Description: Structure to configure each pattern:
+ *  1. The const table of the steps and their number.
+ *  2. TRUE to restart from the first step after the last one, FALSE to stop the pattern with the LED OFF.
+ */
+typedef struct
+{
+    const Led_PatternStepType * Steps_Ptr;
+    uint8 Number_Of_Steps;
+    boolean Repeat;
+}Led_PatternType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description: Set all the LEDs to OFF, the shadow and the pins */
+void Led_Init(void);
+
+
 /* Description: Set the LED state to ON */
-void Led_SetOn(void);
+void Led_SetOn(Led_IdType LedId);
 
 
 /* Description: Set the LED state to OFF */
-void Led_SetOff(void);
+void Led_SetOff(Led_IdType LedId);
+
+
+/*Description: Toggle the LED state, a dimmed LED is turned OFF */
+void Led_Toggle(Led_IdType LedId);
+
+
+/*
+ * Description: Set the brightness of a LED from 0 (OFF) to LED_LEVEL_MAX, the pin is switched to its PWM
+ *              channel for the levels in between and back to Dio for OFF and LED_LEVEL_MAX. The dimming
+ *              is done by the PWM hardware, it costs no CPU time until the next level change.
+ */
+void Led_SetBrightness(Led_IdType LedId, uint8 Level);
+
+
+/* Description: Set the color of an RGB LED, its three pins change together in one masked store */
+void Led_SetColor(Led_IdType RgbId, Led_ColorType Color);
+
 
+/*
+ * Description: Play a pattern on a LED from its first step, the LED takes the level of the step now.
+ *              Led_SetOn, Led_SetOff, Led_Toggle, Led_SetBrightness and Led_SetColor stop the pattern of their LEDs.
+ */
+void Led_PlayPattern(Led_IdType LedId, Led_PatternIdType PatternId);
 
-/*Description: Toggle the LED state */
-void Led_Toggle(void);
 
+/* Description: Stop the pattern of a LED and set it OFF, nothing is done if it plays no pattern */
+void Led_StopPattern(Led_IdType LedId);
 
-/* Description: Refresh the LED state */
+
+/*
+ * Description: Pattern tick called by the periodic pattern timer every LED_PATTERN_TICK_MS, it only visits
+ *              the ports with a step change due and writes the changed pins of each port in one masked store.
+ */
+void Led_PatternMainFunction(void);
+
+
+/*
+ * Description: Rewrite the LED pins whose level differs from the shadow state, one read and at most one store per port.
+ *              The pins driven by their PWM channel are not checked.
+ */
 void Led_RefreshOutput(void);
 
+
+/* Description: Return the number of the LED pins found with a wrong level and corrected by Led_RefreshOutput */
+uint32 Led_GetGlitchCount(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Led */
+extern const Led_PortConfigType Led_PortsConfigurations[LED_NUMBER_OF_PORTS];
+extern const Led_ConfigType Led_Configurations[LED_NUMBER_OF_LEDS];
+extern const Led_RgbConfigType Led_RgbConfigurations[LED_NUMBER_OF_RGB_LEDS];
+extern const Led_PatternType Led_Patterns[LED_NUMBER_OF_PATTERNS];
+
 #endif /* LED_H */
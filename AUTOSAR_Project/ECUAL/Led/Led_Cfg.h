@@ -12,14 +12,57 @@
 #ifndef LED_CFG_H_
 #define LED_CFG_H_
 
-/* Set the led ON/OFF according to its configuration Positive logic or negative logic */
+/* Set the led ON/OFF according to its configuration Positive logic or negative logic (LaunchPad LEDs) */
 #define LED_ON  STD_HIGH
 #define LED_OFF STD_LOW
 
 /* Set the LED Port */
 #define LED_PORT DioConf_LED1_PORT_NUM
 
-/* Set the LED Pin Number */
-#define LED_PIN_NUM DioConf_LED1_CHANNEL_NUM
+/* Number of the LED ports in the array of structures in Led_PBcfg.c */
+#define LED_NUMBER_OF_PORTS                 (1U)
+
+/* Port Index in the array of structures in Led_PBcfg.c */
+#define LedConf_PORTF_INDEX                 (uint8)0x00
+
+/* Number of the LEDs in the array of structures in Led_PBcfg.c */
+#define LED_NUMBER_OF_LEDS                  (3U)
+
+/* LED ID in the array of structures in Led_PBcfg.c */
+#define LedConf_LED1_ID                     (uint8)0x00     /* PF1 red   */
+#define LedConf_LED2_ID                     (uint8)0x01     /* PF2 blue  */
+#define LedConf_LED3_ID                     (uint8)0x02     /* PF3 green */
+
+/* Number of the RGB LEDs in the array of structures in Led_PBcfg.c */
+#define LED_NUMBER_OF_RGB_LEDS              (1U)
+
+/* RGB LED ID in the array of structures in Led_PBcfg.c */
+#define LedConf_RGB1_ID                     (uint8)0x00     /* LaunchPad RGB LED: PF1, PF3, PF2 */
+
+/* Number of the patterns in the array of structures in Led_PBcfg.c */
+#define LED_NUMBER_OF_PATTERNS              (5U)
+
+/* Pattern ID in the array of structures in Led_PBcfg.c */
+#define LedConf_BLINK_PATTERN_ID            (uint8)0x00     /* 1 Hz blink                          */
+#define LedConf_HEARTBEAT_PATTERN_ID        (uint8)0x01     /* Two short beats every second        */
+#define LedConf_ERROR_CODE_3_PATTERN_ID     (uint8)0x02     /* Three blinks then a pause           */
+#define LedConf_BREATHE_PATTERN_ID          (uint8)0x03     /* Brightness ramp up and down         */
+#define LedConf_FLASH_PATTERN_ID            (uint8)0x04     /* One 100 ms flash, then OFF          */
+
+/*
+ * Period of the pattern tick in ms (multiple of the Os tick), the step changes are applied at this
+ * resolution. The step times are counted in Os ticks from Led_PlayPattern so they do not depend on
+ * the phase of the timer. The periodic pattern timer only runs while at least one LED plays a pattern.
+ */
+#define LED_PATTERN_TICK_MS                 (20U)
+
+/*
+ * Number of the slots of the pattern wheel of each port in Os ticks (power of 2). A step longer than the
+ * wheel visits its LED once per turn before it is due, 32 ticks (640 ms) keeps most steps in one turn.
+ */
+#define LED_PATTERN_WHEEL_SIZE              (32U)
+
+/* The periodic software timer calling Led_PatternMainFunction */
+#define LED_PATTERN_TIMER_ID                SwTimerConf_LED_PATTERN_TIMER_ID
 
 #endif /* LED_CFG_H_ */
@@ -0,0 +1,84 @@
+/******************************************************************************
+ *
+ * Module: Led
+ *
+ * File Name: Led_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for Led Module.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "Led.h"
+
+/* Array of structure that hold the LED ports each structure include:
+ * 1. The Dio port of the LEDs.
+ * 2. Mask of the LED pins, the other pins of the port are never written by the Led Module. */
+const Led_PortConfigType Led_PortsConfigurations[LED_NUMBER_OF_PORTS] =
+{
+     { LED_PORT, (Dio_PortLevelType)((1U << DioConf_LED1_CHANNEL_NUM) | (1U << DioConf_LED2_CHANNEL_NUM)
+                                     | (1U << DioConf_LED3_CHANNEL_NUM)) }             /* PORTF: LED1, LED2, LED3 */
+};
+
+/* Array of structure that hold the LEDs each structure include:
+ * 1. Index of the LED port in Led_PortsConfigurations.
+ * 2. Pin number of the LED, it MUST be in the Pins_Mask of its port.
+ * 3. Pin level turning the LED ON.
+ * 4. PWM channel dimming the LED, with the same active level.
+ * 5. Port pin ID and the pin mode of the PWM channel. */
+const Led_ConfigType Led_Configurations[LED_NUMBER_OF_LEDS] =
+{
+     { LedConf_PORTF_INDEX, DioConf_LED1_CHANNEL_NUM, LED_ON,
+       PwmConf_LED1_CHANNEL_ID, PORT_F_PIN_1_INDEX, PORT_F1_MODE_M1PWM5 },  /* LED1: PF1 red   */
+     { LedConf_PORTF_INDEX, DioConf_LED2_CHANNEL_NUM, LED_ON,
+       PwmConf_LED2_CHANNEL_ID, PORT_F_PIN_2_INDEX, PORT_F2_MODE_M1PWM6 },  /* LED2: PF2 blue  */
+     { LedConf_PORTF_INDEX, DioConf_LED3_CHANNEL_NUM, LED_ON,
+       PwmConf_LED3_CHANNEL_ID, PORT_F_PIN_3_INDEX, PORT_F3_MODE_M1PWM7 }   /* LED3: PF3 green */
+};
+
+/* Array of structure that hold the RGB LEDs each structure include:
+ * 1. ID of the red, green and blue LEDs, the three LEDs MUST be in the same port. */
+const Led_RgbConfigType Led_RgbConfigurations[LED_NUMBER_OF_RGB_LEDS] =
+{
+     { LedConf_LED1_ID, LedConf_LED3_ID, LedConf_LED2_ID }        /* RGB1: LaunchPad RGB LED */
+};
+
+/* Pattern steps: brightness level in % and time in ms */
+static const Led_PatternStepType Led_Blink_Steps[] =
+{
+     { LED_LEVEL_MAX, 500U }, { 0U, 500U }
+};
+
+static const Led_PatternStepType Led_Heartbeat_Steps[] =
+{
+     { LED_LEVEL_MAX, 100U }, { 0U, 100U }, { LED_LEVEL_MAX, 100U }, { 0U, 700U }
+};
+
+static const Led_PatternStepType Led_Error_Code_3_Steps[] =
+{
+     { LED_LEVEL_MAX, 200U }, { 0U, 200U }, { LED_LEVEL_MAX, 200U }, { 0U, 200U },
+     { LED_LEVEL_MAX, 200U }, { 0U, 1200U }
+};
+
+static const Led_PatternStepType Led_Breathe_Steps[] =
+{
+     { 0U, 100U }, { 25U, 100U }, { 50U, 100U }, { 75U, 100U },
+     { LED_LEVEL_MAX, 100U }, { 75U, 100U }, { 50U, 100U }, { 25U, 100U }
+};
+
+static const Led_PatternStepType Led_Flash_Steps[] =
+{
+     { LED_LEVEL_MAX, 100U }
+};
+
+/* Array of structure that hold the patterns each structure include:
+ * 1. The steps table and the number of the steps.
+ * 2. Repeat the pattern (TRUE) or stop it with the LED OFF after the last step (FALSE). */
+const Led_PatternType Led_Patterns[LED_NUMBER_OF_PATTERNS] =
+{
+     { Led_Blink_Steps,        (uint8)(sizeof(Led_Blink_Steps) / sizeof(Led_Blink_Steps[0])),               TRUE  },
+     { Led_Heartbeat_Steps,    (uint8)(sizeof(Led_Heartbeat_Steps) / sizeof(Led_Heartbeat_Steps[0])),       TRUE  },
+     { Led_Error_Code_3_Steps, (uint8)(sizeof(Led_Error_Code_3_Steps) / sizeof(Led_Error_Code_3_Steps[0])), TRUE  },
+     { Led_Breathe_Steps,      (uint8)(sizeof(Led_Breathe_Steps) / sizeof(Led_Breathe_Steps[0])),           TRUE  },
+     { Led_Flash_Steps,        (uint8)(sizeof(Led_Flash_Steps) / sizeof(Led_Flash_Steps[0])),               FALSE }
+};
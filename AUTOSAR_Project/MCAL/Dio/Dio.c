@@ -92,7 +92,7 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 * Return value: Dio_LevelType
 * Description: Function to return the value of the specified DIO channel.
 ************************************************************************************/
-Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
+FUNC_RAM Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
     volatile uint32 * Port_Ptr = NULL_PTR;
     Dio_LevelType output = STD_LOW;
@@ -181,7 +181,7 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 * Return value: None
 * Description: Function to set a level of a channel.
 ************************************************************************************/
-void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+FUNC_RAM void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
 	volatile uint32 * Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
@@ -258,6 +258,85 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 
 
 
+/************************************************************************************
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port (0 = PORTA to 5 = PORTF).
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all the channels of the port in one read.
+************************************************************************************/
+FUNC_RAM Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+    volatile uint32 * Port_Ptr = NULL_PTR;
+    Dio_PortLevelType output = 0;
+    boolean error = FALSE;
+
+    /*******************************************************************************
+     *                           Checking on DET Error                             *
+     *******************************************************************************/
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_READ_PORT_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used port is within the valid range */
+    if (DIO_NUMBER_OF_PORTS <= PortId)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /*******************************************************************************
+         *                              Select PORTn                                   *
+         *******************************************************************************/
+        switch(PortId)
+        {
+            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
+                       break;
+            case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
+                       break;
+            case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
+                       break;
+            case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
+                       break;
+            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
+                       break;
+            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
+                       break;
+        }
+        /* The DATA register address unmasks all the 8 pins, one read returns the whole port */
+        output = (Dio_PortLevelType)*Port_Ptr;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return output;
+}
+
+
+
+
 /************************************************************************************
 * Service Name: Dio_GetVersionInfo
 * Service ID[hex]: 0x12
@@ -314,7 +393,7 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 * Description: Function to flip the level of a channel and return the level of the channel after flip.
 ************************************************************************************/
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
-Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+FUNC_RAM Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
 	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
@@ -390,3 +469,85 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
         return output;
 }
 #endif
+
+
+
+
+/************************************************************************************
+* Service Name: Dio_MaskedWritePort
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port (0 = PORTA to 5 = PORTF).
+*                  Level - Value to be written.
+*                  Mask - Channels of the port to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the level of the masked channels of a port in one store without reading it,
+*              the GPIO address mask leaves the other channels untouched even if an interrupt writes them.
+************************************************************************************/
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+FUNC_RAM void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask)
+{
+    uint32 Port_Base = 0;
+    boolean error = FALSE;
+
+    /*******************************************************************************
+     *                           Checking on DET Error                             *
+     *******************************************************************************/
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_MASKED_WRITE_PORT_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used port is within the valid range */
+    if (DIO_NUMBER_OF_PORTS <= PortId)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_MASKED_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /*******************************************************************************
+         *                              Select PORTn                                   *
+         *******************************************************************************/
+        switch(PortId)
+        {
+            case 0:    Port_Base = GPIO_PORTA_DATA_BASE;
+                       break;
+            case 1:    Port_Base = GPIO_PORTB_DATA_BASE;
+                       break;
+            case 2:    Port_Base = GPIO_PORTC_DATA_BASE;
+                       break;
+            case 3:    Port_Base = GPIO_PORTD_DATA_BASE;
+                       break;
+            case 4:    Port_Base = GPIO_PORTE_DATA_BASE;
+                       break;
+            case 5:    Port_Base = GPIO_PORTF_DATA_BASE;
+                       break;
+        }
+        /* One store to the alias of the mask, no read-modify-write */
+        GPIO_MASKED_DATA_REG(Port_Base, Mask) = Level;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
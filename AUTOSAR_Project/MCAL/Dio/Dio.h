@@ -42,6 +42,9 @@
 #define DIO_INITIALIZED                (1U)
 #define DIO_NOT_INITIALIZED            (0U)
 
+/* Number of the GPIO ports (PORTA to PORTF), the valid Dio_PortType values are 0 to 5 */
+#define DIO_NUMBER_OF_PORTS            (6U)
+
 /* Standard AUTOSAR types */
 #include "Std_Types.h"
 
@@ -102,6 +105,9 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO masked write Port */
+#define DIO_MASKED_WRITE_PORT_SID      (uint8)0x13
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -232,6 +238,14 @@ Dio_LevelType Dio_FlipChannel
 );
 #endif
 
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+/* Function for DIO masked write Port API */
+void Dio_MaskedWritePort
+(
+        Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask
+);
+#endif
+
 
 
 /*******************************************************************************
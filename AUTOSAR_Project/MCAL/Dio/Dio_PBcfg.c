@@ -42,5 +42,7 @@
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
                                              DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				                             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+				                             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM,
+				                             DioConf_LED2_PORT_NUM,DioConf_LED2_CHANNEL_NUM,
+				                             DioConf_LED3_PORT_NUM,DioConf_LED3_CHANNEL_NUM
 				                         };
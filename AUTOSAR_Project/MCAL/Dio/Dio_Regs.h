@@ -21,4 +21,18 @@
 #define GPIO_PORTE_DATA_REG       ( *((volatile uint32 *)0x400243FC) )
 #define GPIO_PORTF_DATA_REG       ( *((volatile uint32 *)0x400253FC) )
 
+/*
+ * Base of the masked DATA register window of each port, address bits [9:2] select the pins
+ * a store changes and a load returns (bit n of the offset for pin n-2), the other pins are untouched.
+ */
+#define GPIO_PORTA_DATA_BASE      (0x40004000UL)
+#define GPIO_PORTB_DATA_BASE      (0x40005000UL)
+#define GPIO_PORTC_DATA_BASE      (0x40006000UL)
+#define GPIO_PORTD_DATA_BASE      (0x40007000UL)
+#define GPIO_PORTE_DATA_BASE      (0x40024000UL)
+#define GPIO_PORTF_DATA_BASE      (0x40025000UL)
+
+/* The DATA register alias of a port base writing or reading the pins of the mask only */
+#define GPIO_MASKED_DATA_REG(BASE,MASK)  ( *((volatile uint32 *)((BASE) + ((uint32)(MASK) << 2))) )
+
 #endif /* DIO_REGS_H */
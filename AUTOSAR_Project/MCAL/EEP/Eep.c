@@ -0,0 +1,200 @@
+ /******************************************************************************
+ *
+ * Module: EEP
+ *
+ * File Name: Eep.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - EEPROM Driver.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Eep.h"
+#include "Eep_Regs.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define EEPROM_CLOCK_MASK               0x00000001         // EEPROM bit mask in RCGCEEPROM and PREEPROM registers.
+#define EEPROM_EEDONE_WORKING_MASK      0x00000001         // Working bit mask in EEDONE register.
+#define EEPROM_EEDONE_ERRORS_MASK       0x0000003C         // WRBUSY, NOPERM, WKCOPY and WKERASE bits mask in EEDONE register.
+#define EEPROM_EESUPP_RETRY_MASK        0x0000000C         // PRETRY and ERETRY bits mask in EESUPP register.
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+static Eep_StatusType g_Eep_Status = EEP_UNINIT;
+
+/* The running write job */
+static const uint32 * g_Eep_Write_Data_Ptr = NULL_PTR;
+static uint8 g_Eep_Write_Words = 0;
+static uint8 g_Eep_Write_Index = 0;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Eep_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the EEPROM module and wait for its power on checks,
+*              the status is EEP_FAILED if the EEPROM reports a failed recovery.
+************************************************************************************/
+void Eep_Init(void)
+{
+    /* Enable clock for the EEPROM and wait for clock to start */
+    SYSCTL_RCGCEEPROM_REG |= EEPROM_CLOCK_MASK;
+    while(!(SYSCTL_PREEPROM_REG & EEPROM_CLOCK_MASK));
+
+    /* Wait for the power on recovery of an interrupted write */
+    while(EEPROM_EEDONE_REG & EEPROM_EEDONE_WORKING_MASK);
+
+    if(EEPROM_EESUPP_REG & EEPROM_EESUPP_RETRY_MASK)
+    {
+        g_Eep_Status = EEP_FAILED;
+    }
+    else
+    {
+        g_Eep_Status = EEP_IDLE;
+    }
+}
+
+
+/************************************************************************************
+* Service Name: Eep_Read
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Block - EEPROM block (0 to EEP_NUMBER_OF_BLOCKS - 1)
+*                  Words - Number of words read from the start of the block (up to EEP_WORDS_PER_BLOCK)
+* Parameters (inout): None
+* Parameters (out): Data_Ptr - Read words
+* Return value: Std_ReturnType - E_NOT_OK if the parameters are invalid or a write job is running
+* Description: Function to read words from the start of an EEPROM block.
+************************************************************************************/
+Std_ReturnType Eep_Read(uint8 Block, uint32 * Data_Ptr, uint8 Words)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 index = 0;
+
+    if((EEP_UNINIT != g_Eep_Status) && (EEP_BUSY != g_Eep_Status) && (NULL_PTR != Data_Ptr)
+        && (Block < EEP_NUMBER_OF_BLOCKS) && (Words <= EEP_WORDS_PER_BLOCK))
+    {
+        EEPROM_EEBLOCK_REG  = Block;
+        EEPROM_EEOFFSET_REG = 0;
+        for(index = 0; index < Words; index++)
+        {
+            Data_Ptr[index] = EEPROM_EERDWRINC_REG;     /* The offset is incremented after each read */
+        }
+        ret = E_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+
+/************************************************************************************
+* Service Name: Eep_Write
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Block - EEPROM block (0 to EEP_NUMBER_OF_BLOCKS - 1)
+*                  Offset - First written word of the block
+*                  Data_Ptr - Words to write, the buffer must be kept until the job ends
+*                  Words - Number of words written from the offset (up to EEP_WORDS_PER_BLOCK - Offset)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the parameters are invalid or a write job is running
+* Description: Function to start a write job, Eep_MainFunction writes one word each time
+*              the EEPROM is ready and the status returns to EEP_IDLE (or EEP_FAILED) at the end.
+*              The words are written in order, a job interrupted by a reset leaves the words
+*              before the interrupted one written and the words after it unchanged.
+************************************************************************************/
+Std_ReturnType Eep_Write(uint8 Block, uint8 Offset, const uint32 * Data_Ptr, uint8 Words)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((EEP_UNINIT != g_Eep_Status) && (EEP_BUSY != g_Eep_Status) && (NULL_PTR != Data_Ptr)
+        && (Block < EEP_NUMBER_OF_BLOCKS) && (Words > 0) && (Offset < EEP_WORDS_PER_BLOCK)
+        && (Words <= (EEP_WORDS_PER_BLOCK - Offset)))
+    {
+        EEPROM_EEBLOCK_REG  = Block;
+        EEPROM_EEOFFSET_REG = Offset;
+        g_Eep_Write_Data_Ptr = Data_Ptr;
+        g_Eep_Write_Words    = Words;
+        g_Eep_Write_Index    = 0;
+        g_Eep_Status         = EEP_BUSY;
+        ret = E_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+
+/************************************************************************************
+* Service Name: Eep_GetStatus
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Eep_StatusType - State of the driver
+* Description: Function to return the state of the driver and of the last write job.
+************************************************************************************/
+Eep_StatusType Eep_GetStatus(void)
+{
+    return g_Eep_Status;
+}
+
+
+/************************************************************************************
+* Service Name: Eep_MainFunction
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to advance the write job, it never waits for the EEPROM.
+************************************************************************************/
+void Eep_MainFunction(void)
+{
+    if((EEP_BUSY == g_Eep_Status) && (0 == (EEPROM_EEDONE_REG & EEPROM_EEDONE_WORKING_MASK)))
+    {
+        if(EEPROM_EEDONE_REG & EEPROM_EEDONE_ERRORS_MASK)
+        {
+            /* The last word was not written, the job is stopped */
+            g_Eep_Status = EEP_FAILED;
+        }
+        else if(g_Eep_Write_Index < g_Eep_Write_Words)
+        {
+            /* Start programming the next word, the offset is incremented after the write */
+            EEPROM_EERDWRINC_REG = g_Eep_Write_Data_Ptr[g_Eep_Write_Index];
+            g_Eep_Write_Index++;
+        }
+        else
+        {
+            /* The last word is programmed */
+            g_Eep_Status = EEP_IDLE;
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
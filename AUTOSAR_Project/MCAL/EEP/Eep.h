@@ -0,0 +1,121 @@
+ /******************************************************************************
+ *
+ * Module: EEP
+ *
+ * File Name: Eep.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - EEPROM Driver.
+ *              The reads are synchronous, the writes are jobs of up to one block
+ *              advanced by Eep_MainFunction so the caller never waits for the
+ *              EEPROM programming time.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef EEP_H
+#define EEP_H
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Std_Types.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* EEPROM geometry of the TM4C123GH6PM: 2 KB in 32 blocks of 16 words */
+#define EEP_NUMBER_OF_BLOCKS                (32U)
+#define EEP_WORDS_PER_BLOCK                 (16U)
+
+/* Value of an erased (never written) word */
+#define EEP_ERASED_WORD                     (0xFFFFFFFFUL)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: State of the EEPROM driver */
+typedef enum
+{
+    EEP_UNINIT, EEP_IDLE, EEP_BUSY, EEP_FAILED
+}Eep_StatusType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Eep_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the EEPROM module and wait for its power on checks,
+*              the status is EEP_FAILED if the EEPROM reports a failed recovery.
+************************************************************************************/
+void Eep_Init(void);
+
+
+/************************************************************************************
+* Service Name: Eep_Read
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Block - EEPROM block (0 to EEP_NUMBER_OF_BLOCKS - 1)
+*                  Words - Number of words read from the start of the block (up to EEP_WORDS_PER_BLOCK)
+* Parameters (inout): None
+* Parameters (out): Data_Ptr - Read words
+* Return value: Std_ReturnType - E_NOT_OK if the parameters are invalid or a write job is running
+* Description: Function to read words from the start of an EEPROM block.
+************************************************************************************/
+Std_ReturnType Eep_Read(uint8 Block, uint32 * Data_Ptr, uint8 Words);
+
+
+/************************************************************************************
+* Service Name: Eep_Write
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Block - EEPROM block (0 to EEP_NUMBER_OF_BLOCKS - 1)
+*                  Offset - First written word of the block
+*                  Data_Ptr - Words to write, the buffer must be kept until the job ends
+*                  Words - Number of words written from the offset (up to EEP_WORDS_PER_BLOCK - Offset)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the parameters are invalid or a write job is running
+* Description: Function to start a write job, Eep_MainFunction writes one word each time
+*              the EEPROM is ready and the status returns to EEP_IDLE (or EEP_FAILED) at the end.
+*              The words are written in order, a job interrupted by a reset leaves the words
+*              before the interrupted one written and the words after it unchanged.
+************************************************************************************/
+Std_ReturnType Eep_Write(uint8 Block, uint8 Offset, const uint32 * Data_Ptr, uint8 Words);
+
+
+/************************************************************************************
+* Service Name: Eep_GetStatus
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Eep_StatusType - State of the driver
+* Description: Function to return the state of the driver and of the last write job.
+************************************************************************************/
+Eep_StatusType Eep_GetStatus(void);
+
+
+/************************************************************************************
+* Service Name: Eep_MainFunction
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to advance the write job, it never waits for the EEPROM.
+************************************************************************************/
+void Eep_MainFunction(void);
+
+#endif /* EEP_H */
@@ -0,0 +1,32 @@
+ /******************************************************************************
+ *
+ * Module: EEP
+ *
+ * File Name: Eep_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - EEPROM Driver Registers
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef MCAL_EEP_EEP_REGS_H_
+#define MCAL_EEP_EEP_REGS_H_
+
+#include "Std_Types.h"
+
+/*****************************************************************************
+                        System Control Registers
+*****************************************************************************/
+#define SYSCTL_RCGCEEPROM_REG     ( *((volatile uint32 *)0x400FE658) )
+#define SYSCTL_PREEPROM_REG       ( *((volatile uint32 *)0x400FEA58) )
+
+/*****************************************************************************
+                        EEPROM Registers
+*****************************************************************************/
+#define EEPROM_EEBLOCK_REG        ( *((volatile uint32 *)0x400AF004) )
+#define EEPROM_EEOFFSET_REG       ( *((volatile uint32 *)0x400AF008) )
+#define EEPROM_EERDWRINC_REG      ( *((volatile uint32 *)0x400AF014) )
+#define EEPROM_EEDONE_REG         ( *((volatile uint32 *)0x400AF018) )
+#define EEPROM_EESUPP_REG         ( *((volatile uint32 *)0x400AF01C) )
+
+#endif /* MCAL_EEP_EEP_REGS_H_ */
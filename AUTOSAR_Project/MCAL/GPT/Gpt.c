@@ -21,11 +21,55 @@
  *                             PreProcessor Macros                             *
  *******************************************************************************/
 
-#define SYSTICK_CTRL_COUNT_FLAG_MASK    0x00010000         // Count flag bit mask in SysTick CTRL register.
 #define SYSTICK_CTRL_ENABLE_MASK        0x00000001         // Enable bit mask in SysTick CTRL register.
 #define SYSTICK_PRIORITY_MASK           0x1FFFFFFF         // Priority bit mask in NVIC_SYSTEM_PRI3_REG.
 #define SYSTICK_INTERRUPT_PRIORITY      3
 #define SYSTICK_PRIORITY_BITS_POS       29
+#define SYSTICK_PEND_SET_MASK           0x04000000         // PENDSTSET bit mask in the INTCTRL register.
+#define SYSTICK_MAX_COUNT               0x01000000         // Number of counts of the 24-bit SysTick counter.
+#define SYSTICK_REPROGRAM_CYCLES        8                  // Cycles from reading the current value to clearing it in SysTick_SetNextInterrupt.
+#define SYSTICK_REPROGRAM_MARGIN        64                 // Minimum cycles to the next interrupt to be able to reprogram it safely.
+#define CORE_DEMCR_TRCENA_MASK          0x01000000         // Trace enable bit mask in DEMCR register.
+#define DWT_CTRL_CYCCNTENA_MASK         0x00000001         // Cycle counter enable bit mask in DWT CTRL register.
+#define WTIMER0_CLOCK_MASK              0x00000001         // Wide Timer 0 bit mask in RCGCWTIMER and PRWTIMER registers.
+#define WTIMER_CFG_64_BIT               0x00000000         // Timer A and Timer B concatenated as one 64-bit timer.
+#define WTIMER_TAMR_PERIODIC            0x00000002         // Periodic mode in TAMR register.
+#define WTIMER_TAMR_COUNT_UP_MASK       0x00000010         // Count direction up bit mask in TAMR register.
+#define WTIMER_CTL_TAEN_MASK            0x00000001         // Timer enable bit mask in CTL register.
+#define WTIMER_MAX_LOAD                 0xFFFFFFFF         // Load value of each 32-bit half for the full 64-bit range.
+
+/*
+ * Disable the IRQ interrupts (set the I-bit in the PRIMASK) and return the previous PRIMASK, then restore it,
+ * used to update the subscribers table so a caller that already disabled the interrupts keeps them disabled.
+ */
+#if defined(__TI_ARM__)
+#define Gpt_DisableInterrupts()         ((uint32)_disable_IRQ())
+#define Gpt_RestoreInterrupts(PRIMASK)  ((void)_restore_interrupts(PRIMASK))
+#else
+#define Gpt_DisableInterrupts()         Gpt_ReadPrimaskAndDisable()
+#define Gpt_RestoreInterrupts(PRIMASK)  __asm volatile(" MSR PRIMASK, %0" : : "r" (PRIMASK) : "memory")
+
+LOCAL_INLINE uint32 Gpt_ReadPrimaskAndDisable(void)
+{
+    uint32 primask = 0;
+
+    __asm volatile(" MRS %0, PRIMASK\n CPSID I" : "=r" (primask) : : "memory");
+    return primask;
+}
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Function called by the SysTick interrupt every Divisor periods */
+typedef struct
+{
+    void (*Callback_Ptr)(void);
+    uint32 Count;
+    uint16 Divisor;
+    uint8 Priority;
+}SysTick_SubscriberType;
 
 /*******************************************************************************
  *                             Global Variables                                *
@@ -34,6 +78,22 @@
 /* Global pointer to function used to point upper layer functions to be used in Call Back */
 static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 
+/* The functions called by the SysTick interrupt sorted by their priority */
+static SysTick_SubscriberType g_SysTick_Subscribers[GPT_SYSTICK_MAX_SUBSCRIBERS];
+static uint8 g_SysTick_Subscribers_Count = 0;
+
+/* The reload value of the base period configured by SysTick_Init */
+static uint32 g_SysTick_Reload = 0;
+
+/* Number of the base periods to the next interrupt, set by SysTick_SetNextInterrupt */
+static uint16 g_SysTick_Next_Periods = 1;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void SysTick_RemoveSubscriber(void (*Ptr2Func)(void));
+
 /*******************************************************************************
  *                          Functions Definitions                              *
  *******************************************************************************/
@@ -47,14 +107,31 @@ static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
  * Parameters (out): None
  * Return value: None
  * Description: Handler for SysTick interrupt use to call
- * the call-back function.
+ * the subscribed functions in their priority order.
  * ********************************************************************/
-void SysTick_Handler(void)
+FUNC_RAM void SysTick_Handler(void)
 {
-    /* Check if the SysTick_SetCallBack is already called */
-    if(g_SysTick_Call_Back_Ptr != NULL_PTR)
+    SysTick_SubscriberType * Subscriber_Ptr = &g_SysTick_Subscribers[0];
+    uint16 periods = g_SysTick_Next_Periods;
+    uint8 index = 0;
+
+    g_SysTick_Next_Periods = 1;
+
+    /* Bounded by GPT_SYSTICK_MAX_SUBSCRIBERS, only a counter per subscriber is updated */
+    for(index = 0; index < g_SysTick_Subscribers_Count; index++)
     {
-        (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
+        Subscriber_Ptr->Count += periods;
+        if(Subscriber_Ptr->Count >= Subscriber_Ptr->Divisor)
+        {
+            /* Keep the phase of the divisor if several periods passed (tickless Os mode) */
+            Subscriber_Ptr->Count = (1 == Subscriber_Ptr->Divisor) ? 0 : (Subscriber_Ptr->Count % Subscriber_Ptr->Divisor);
+            (*Subscriber_Ptr->Callback_Ptr)(); /* call the function in the upper layer using call-back concept */
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Subscriber_Ptr++;
     }
     /* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
 }
@@ -76,7 +153,8 @@ void SysTick_Handler(void)
 void SysTick_Init(uint16 a_TimeInMilliSeconds)
 {
     SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * a_TimeInMilliSeconds;         /* Set the Reload value to count n miliseconds */
+    g_SysTick_Reload    = 15999 * a_TimeInMilliSeconds;
+    SYSTICK_RELOAD_REG  = g_SysTick_Reload;          /* Set the Reload value to count n miliseconds */
     SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
     /* Configure the SysTick Control Register 
      * Enable the SysTick Timer (ENABLE = 1)
@@ -88,35 +166,110 @@ void SysTick_Init(uint16 a_TimeInMilliSeconds)
 }
 
 
+/************************************************************************************
+* Service Name: SysTick_SetNextInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): a_Periods - Number of base periods from the last interrupt to the next one
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Number of base periods actually programmed
+* Description: Function to delay the next SysTick interrupt to a_Periods base periods after the
+*              last interrupt (one-shot), the following periods return to the base period.
+*              The counter is not stopped and the elapsed part of the current period is kept
+*              so the time base does not drift. The interval is limited by the 24-bit counter,
+*              and it is not changed (1 is returned) if the interrupt is already pending or too close.
+*              It must be called with the interrupts disabled just after a SysTick interrupt.
+************************************************************************************/
+uint16 SysTick_SetNextInterrupt(uint16 a_Periods)
+{
+    uint32 period    = g_SysTick_Reload + 1;
+    uint32 remaining = 0;
+    uint32 max_periods = 0;
+    uint16 periods = 1;
+
+    if((a_Periods > 1) && (0 == (NVIC_SYSTEM_INTCTRL_REG & SYSTICK_PEND_SET_MASK)))
+    {
+        /* Cycles left to the end of the current base period */
+        remaining = SYSTICK_CURRENT_REG;
+        if(remaining > SYSTICK_REPROGRAM_MARGIN)
+        {
+            max_periods = 1 + ((SYSTICK_MAX_COUNT - remaining) / period);
+            periods = (a_Periods > max_periods) ? (uint16)max_periods : a_Periods;
+            if(periods > 1)
+            {
+                /* Writing the current value clears it and the counter loads the long reload value at the next clock */
+                SYSTICK_RELOAD_REG  = remaining + ((periods - 1) * period) - SYSTICK_REPROGRAM_CYCLES - 1;
+                SYSTICK_CURRENT_REG = 0;
+                /* Used from the next interrupt, the period after it is the base period again */
+                SYSTICK_RELOAD_REG  = g_SysTick_Reload;
+                g_SysTick_Next_Periods = periods;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return periods;
+}
+
+
 /*********************************************************************
  * Service Name: SysTick_StartBusyWait
- * Sync/Async:
- * Reentrancy:
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
  * Parameters (in): a_TimeInMilliSeconds - Time in MilliSeconds
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Initialize the SysTick timer with the specified time
- * in milliseconds using polling or busy-wait technique. The function
- * should exit when the time is elapsed and stops the timer at the end.
+ * Description: Busy wait the specified time in milliseconds using the
+ * DWT cycle counter, the SysTick timer (Os tick) is not changed.
  * ********************************************************************/
 void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds)
 {
-    SYSTICK_CTRL_REG    = 0;                                            // Disable the SysTick Timer by Clear the ENABLE Bit.
-
-    SYSTICK_RELOAD_REG  = 15999 * a_TimeInMilliSeconds;                            // Set the Reload value to count Seconds.
-
-    SYSTICK_CURRENT_REG = 0;                                            // Clear the Current Register value.
-
-    SYSTICK_CTRL_REG   |= 0x05;                                         // Enable SysTick timer & choose the clock source to be system clock.
+    /* The SysTick keeps generating the Os tick, the wait uses the free running cycle counter */
+    Delay_Us((uint32)a_TimeInMilliSeconds * 1000UL);
+}
 
-    while( !(SYSTICK_CTRL_REG  &  SYSTICK_CTRL_COUNT_FLAG_MASK) );      // Wait until the COUNT flag = 1.
 
-    SYSTICK_CTRL_REG    = 0;                                            // Disable the SysTick Timer by Clear the ENABLE Bit.
+/************************************************************************************
+* Service Name: Delay_Us
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_TimeInMicroSeconds - Time in micro-seconds (up to 268 s at 16 MHz)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to spin the specified time using the DWT cycle counter,
+*              the SysTick timer is not used and the interrupts stay enabled.
+************************************************************************************/
+void Delay_Us(uint32 a_TimeInMicroSeconds)
+{
+    uint32 start_cycles = 0;
+    uint32 delay_cycles = a_TimeInMicroSeconds * GPT_CYCLES_PER_US;
 
-    SYSTICK_RELOAD_REG  = 0;                                            // Set the Reload value 0.
+    /* Start the cycle counter if no one started it yet */
+    if(0 == (DWT_CTRL_REG & DWT_CTRL_CYCCNTENA_MASK))
+    {
+        Dwt_CycleCounterInit();
+    }
+    else
+    {
+        /* No Action Required */
+    }
 
-    SYSTICK_CURRENT_REG = 0;                                            // Clear the Current Register value.
+    /* The unsigned subtraction gives the correct time even if the counter wraps around during the wait */
+    start_cycles = DWT_CYCCNT_REG;
+    while((DWT_CYCCNT_REG - start_cycles) < delay_cycles);
 }
 
 
@@ -160,7 +313,8 @@ void SysTick_Start(void)
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to Deinitialize the SysTick Timer.
+ * Description: Function to Deinitialize the SysTick Timer, the subscribers
+ * are kept, each module removes its own one by SysTick_Unsubscribe.
  * ********************************************************************/
 void SysTick_DeInit(void)
 {
@@ -170,7 +324,7 @@ void SysTick_DeInit(void)
 
     SYSTICK_CURRENT_REG = 0;        // Clear the Current Register value.
 
-    g_SysTick_Call_Back_Ptr = NULL_PTR;
+    g_SysTick_Next_Periods = 1;
 }
 
 
@@ -182,9 +336,210 @@ void SysTick_DeInit(void)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to Setup the SysTick Timer call back, it is subscribed every
+*              interrupt with GPT_SYSTICK_CALLBACK_PRIORITY and replaces the previous one.
 ************************************************************************************/
 void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
+    SysTick_Unsubscribe(g_SysTick_Call_Back_Ptr);
     g_SysTick_Call_Back_Ptr = Ptr2Func;
+    (void)SysTick_Subscribe(Ptr2Func, 1, GPT_SYSTICK_CALLBACK_PRIORITY);
+}
+
+
+/************************************************************************************
+* Service Name: SysTick_Subscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Function called by the SysTick interrupt
+*                  a_Divisor - Number of SysTick periods between two calls (1 for every interrupt)
+*                  a_Priority - Order of the call in the interrupt, 0 is called first
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the table is full or the parameters are invalid
+* Description: Function to add a function to the SysTick interrupt in its priority order.
+*              The interrupts are disabled while the table is changed and restored to their previous state,
+*              so it can be called inside an interrupt lock. It must be called at task level.
+************************************************************************************/
+Std_ReturnType SysTick_Subscribe(void (*Ptr2Func)(void), uint16 a_Divisor, uint8 a_Priority)
+{
+    uint8 index = 0;
+    uint32 primask = 0;
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL_PTR != Ptr2Func) && (a_Divisor > 0))
+    {
+        primask = Gpt_DisableInterrupts();
+
+        /* A function is subscribed once, subscribing it again changes its divisor and priority */
+        SysTick_RemoveSubscriber(Ptr2Func);
+
+        if(g_SysTick_Subscribers_Count < GPT_SYSTICK_MAX_SUBSCRIBERS)
+        {
+            /* Shift the lower priority subscribers, the equal priorities keep the subscription order */
+            index = g_SysTick_Subscribers_Count;
+            while((index > 0) && (g_SysTick_Subscribers[index - 1].Priority > a_Priority))
+            {
+                g_SysTick_Subscribers[index] = g_SysTick_Subscribers[index - 1];
+                index--;
+            }
+            g_SysTick_Subscribers[index].Callback_Ptr = Ptr2Func;
+            g_SysTick_Subscribers[index].Count        = 0;
+            g_SysTick_Subscribers[index].Divisor      = a_Divisor;
+            g_SysTick_Subscribers[index].Priority     = a_Priority;
+            g_SysTick_Subscribers_Count++;
+            ret = E_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+
+        Gpt_RestoreInterrupts(primask);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+
+/************************************************************************************
+* Service Name: SysTick_Unsubscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Function subscribed by SysTick_Subscribe
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to remove a function from the SysTick interrupt, nothing is done if
+*              it is not subscribed. The interrupts are restored to their previous state after the change.
+*              It must be called at task level.
+************************************************************************************/
+void SysTick_Unsubscribe(void (*Ptr2Func)(void))
+{
+    uint32 primask = 0;
+
+    if(NULL_PTR != Ptr2Func)
+    {
+        primask = Gpt_DisableInterrupts();
+        SysTick_RemoveSubscriber(Ptr2Func);
+        Gpt_RestoreInterrupts(primask);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+
+/* Description: Remove a function from the subscribers table and close the gap, called with the interrupts disabled */
+static void SysTick_RemoveSubscriber(void (*Ptr2Func)(void))
+{
+    uint8 index = 0;
+    boolean found = FALSE;
+
+    for(index = 0; index < g_SysTick_Subscribers_Count; index++)
+    {
+        if(TRUE == found)
+        {
+            g_SysTick_Subscribers[index - 1] = g_SysTick_Subscribers[index];
+        }
+        else if(Ptr2Func == g_SysTick_Subscribers[index].Callback_Ptr)
+        {
+            found = TRUE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    if(TRUE == found)
+    {
+        g_SysTick_Subscribers_Count--;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+
+/************************************************************************************
+* Service Name: Dwt_CycleCounterInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the DWT cycle counter, the counter is cleared
+*              and counts the CPU clock cycles, use Dwt_GetCycleCount to read it.
+************************************************************************************/
+void Dwt_CycleCounterInit(void)
+{
+    CORE_DEMCR_REG |= CORE_DEMCR_TRCENA_MASK;       /* Enable the DWT and ITM units */
+    DWT_CYCCNT_REG  = 0;                            /* Clear the cycle counter */
+    DWT_CTRL_REG   |= DWT_CTRL_CYCCNTENA_MASK;      /* Start the cycle counter */
+}
+
+
+/************************************************************************************
+* Service Name: Gpt_TimestampInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the Wide Timer 0 as a free running 64-bit up counter
+*              at the system clock, it is the time base of Gpt_GetTimestamp.
+************************************************************************************/
+void Gpt_TimestampInit(void)
+{
+    /* Enable clock for the Wide Timer 0 and wait for clock to start */
+    SYSCTL_RCGCWTIMER_REG |= WTIMER0_CLOCK_MASK;
+    while(!(SYSCTL_PRWTIMER_REG & WTIMER0_CLOCK_MASK));
+
+    WTIMER0_CTL_REG   = 0;                                                  /* Disable the timer during the configuration */
+    WTIMER0_CFG_REG   = WTIMER_CFG_64_BIT;                                  /* One 64-bit timer, Timer B holds the upper half */
+    WTIMER0_TAMR_REG  = WTIMER_TAMR_PERIODIC | WTIMER_TAMR_COUNT_UP_MASK;   /* Periodic mode counting up from 0 */
+    WTIMER0_TAILR_REG = WTIMER_MAX_LOAD;                                    /* Wraps after 2^64 cycles (36000 years at 16 MHz) */
+    WTIMER0_TBILR_REG = WTIMER_MAX_LOAD;
+    WTIMER0_CTL_REG   = WTIMER_CTL_TAEN_MASK;                               /* Start the timer, no interrupt is used */
+}
+
+
+/************************************************************************************
+* Service Name: Gpt_GetTimestamp
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_TimestampType - Time in CPU cycles since Gpt_TimestampInit
+* Description: Function to read the 64-bit timestamp, the read is consistent without
+*              disabling the interrupts so it can be used from the tasks and the ISRs.
+************************************************************************************/
+Gpt_TimestampType Gpt_GetTimestamp(void)
+{
+    uint32 high = 0;
+    uint32 low  = 0;
+    uint32 high_check = WTIMER0_TBV_REG;
+
+    /*
+     * The two halves are read by two loads, if the lower half overflows between them the upper
+     * half is read again until it does not change around the lower half read (a carry happens
+     * every 268 s so the loop runs twice at most). An interrupt between the loads only delays
+     * the read, it can not give a torn value.
+     */
+    do
+    {
+        high = high_check;
+        low  = WTIMER0_TAV_REG;
+        high_check = WTIMER0_TBV_REG;
+    } while(high != high_check);
+
+    return (((Gpt_TimestampType)high << 32) | low);
 }
@@ -18,6 +18,45 @@
 
 #include "Std_Types.h"
 
+/* GPT Pre-Compile Configuration Header file */
+#include "Gpt_Cfg.h"
+
+/* The "Gpt_Regs.h" is not AUTOSAR file so there is no version checking */
+#include "Gpt_Regs.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#if defined(HOST_SIM)
+/* Host simulation build, the cycle counter is the virtual clock (Simulation/Sim_Gpt.c) */
+uint32 Sim_GetCycleCount(void);
+#define Dwt_GetCycleCount()       (Sim_GetCycleCount())
+#else
+/* Read the free running DWT cycle counter (CPU cycles), it is a single load so it can be used in the hot paths */
+#define Dwt_GetCycleCount()       (DWT_CYCCNT_REG)
+#endif
+
+/* Time in micro-seconds elapsed since a cycle counter value read by Dwt_GetCycleCount (up to 268 s at 16 MHz) */
+#define Dwt_GetElapsedUs(START_CYCLES) \
+        ((Dwt_GetCycleCount() - (uint32)(START_CYCLES)) / GPT_CYCLES_PER_US)
+
+/* Non-blocking timeout check for polling loops, TRUE when TIME_US elapsed since START_CYCLES */
+#define Dwt_IsTimeElapsed(START_CYCLES, TIME_US) \
+        ((Dwt_GetCycleCount() - (uint32)(START_CYCLES)) >= ((uint32)(TIME_US) * GPT_CYCLES_PER_US))
+
+/* Convert a timestamp (CPU cycles) to milli-seconds, micro-seconds and nano-seconds */
+#define Gpt_TimestampToMs(TIMESTAMP)    ((uint64)(TIMESTAMP) / (GPT_CYCLES_PER_US * 1000UL))
+#define Gpt_TimestampToUs(TIMESTAMP)    ((uint64)(TIMESTAMP) / GPT_CYCLES_PER_US)
+#define Gpt_TimestampToNs(TIMESTAMP)    (((uint64)(TIMESTAMP) * 1000ULL) / GPT_CYCLES_PER_US)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Monotonic time in CPU cycles since Gpt_TimestampInit, it never wraps in the life time of the ECU */
+typedef uint64 Gpt_TimestampType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
@@ -38,21 +77,48 @@
 void SysTick_Init(uint16 a_TimeInMilliSeconds);
 
 
+/************************************************************************************
+* Service Name: SysTick_SetNextInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): a_Periods - Number of base periods from the last interrupt to the next one
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Number of base periods actually programmed
+* Description: Function to delay the next SysTick interrupt to a_Periods base periods after the
+*              last interrupt (one-shot) without losing the phase of the time base.
+************************************************************************************/
+uint16 SysTick_SetNextInterrupt(uint16 a_Periods);
+
+
 /*********************************************************************
  * Service Name: SysTick_StartBusyWait
- * Sync/Async:
- * Reentrancy:
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
  * Parameters (in): a_TimeInMilliSeconds - Time in MilliSeconds
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Initialize the SysTick timer with the specified time
- * in milliseconds using polling or busy-wait technique. The function
- * should exit when the time is elapsed and stops the timer at the end.
+ * Description: Busy wait the specified time in milliseconds using the
+ * DWT cycle counter, the SysTick timer (Os tick) is not changed.
  * ********************************************************************/
 void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds);
 
 
+/************************************************************************************
+* Service Name: Delay_Us
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): a_TimeInMicroSeconds - Time in micro-seconds (up to 268 s at 16 MHz)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to spin the specified time using the DWT cycle counter,
+*              the SysTick timer is not used and the interrupts stay enabled.
+************************************************************************************/
+void Delay_Us(uint32 a_TimeInMicroSeconds);
+
+
 /************************************************************************************
 * Service Name: SysTick_Stop
 * Sync/Async: Synchronous
@@ -87,7 +153,8 @@ void SysTick_Start(void);
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Function to Deinitialize the SysTick Timer.
+ * Description: Function to Deinitialize the SysTick Timer, the subscribers
+ * are kept, each module removes its own one by SysTick_Unsubscribe.
  * ********************************************************************/
 void SysTick_DeInit(void);
 
@@ -100,8 +167,85 @@ void SysTick_DeInit(void);
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to Setup the SysTick Timer call back, it is subscribed every
+*              interrupt with GPT_SYSTICK_CALLBACK_PRIORITY and replaces the previous one.
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+
+/************************************************************************************
+* Service Name: SysTick_Subscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Function called by the SysTick interrupt
+*                  a_Divisor - Number of SysTick periods between two calls (1 for every interrupt)
+*                  a_Priority - Order of the call in the interrupt, 0 is called first
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the table is full or the parameters are invalid
+* Description: Function to add a function to the SysTick interrupt, the subscribers are called
+*              in the priority order (equal priorities in the subscription order). Subscribing an
+*              already subscribed function changes its divisor and priority.
+*              In the tickless Os mode the interrupts can be several periods apart, a subscriber
+*              is then called once at the first interrupt after its period is elapsed.
+*              It must be called at task level, not from the subscribers themselves.
+************************************************************************************/
+Std_ReturnType SysTick_Subscribe(void (*Ptr2Func)(void), uint16 a_Divisor, uint8 a_Priority);
+
+
+/************************************************************************************
+* Service Name: SysTick_Unsubscribe
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Ptr2Func - Function subscribed by SysTick_Subscribe
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to remove a function from the SysTick interrupt, nothing is done if
+*              it is not subscribed. It must be called at task level.
+************************************************************************************/
+void SysTick_Unsubscribe(void (*Ptr2Func)(void));
+
+
+/************************************************************************************
+* Service Name: Dwt_CycleCounterInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the DWT cycle counter, the counter is cleared
+*              and counts the CPU clock cycles, use Dwt_GetCycleCount to read it.
+************************************************************************************/
+void Dwt_CycleCounterInit(void);
+
+
+/************************************************************************************
+* Service Name: Gpt_TimestampInit
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the Wide Timer 0 as a free running 64-bit up counter
+*              at the system clock, it is the time base of Gpt_GetTimestamp.
+************************************************************************************/
+void Gpt_TimestampInit(void);
+
+
+/************************************************************************************
+* Service Name: Gpt_GetTimestamp
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Gpt_TimestampType - Time in CPU cycles since Gpt_TimestampInit
+* Description: Function to read the 64-bit timestamp, the read is consistent without
+*              disabling the interrupts so it can be used from the tasks and the ISRs.
+************************************************************************************/
+Gpt_TimestampType Gpt_GetTimestamp(void);
+
 #endif /* GPT_H */
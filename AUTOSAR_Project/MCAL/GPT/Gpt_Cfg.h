@@ -0,0 +1,29 @@
+ /******************************************************************************
+ *
+ * Module: GPT
+ *
+ * File Name: Gpt_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - GPT Driver.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef GPT_CFG_H_
+#define GPT_CFG_H_
+
+#include "MCAL/MCU/Mcu_Cfg.h"
+
+/* System clock frequency in Hz, used to convert the DWT cycles to micro-seconds */
+#define GPT_CPU_CLOCK_HZ                    MCU_SYSTEM_CLOCK_HZ
+
+/* Number of the CPU cycles in one micro-second */
+#define GPT_CYCLES_PER_US                   (GPT_CPU_CLOCK_HZ / 1000000UL)
+
+/* Maximum number of the functions called by the SysTick interrupt (SysTick_Subscribe), up to 255 */
+#define GPT_SYSTICK_MAX_SUBSCRIBERS         (8U)
+
+/* Priority of the call back set by SysTick_SetCallBack (the Os tick), it is called before all the other subscribers */
+#define GPT_SYSTICK_CALLBACK_PRIORITY       (0U)
+
+#endif /* GPT_CFG_H_ */
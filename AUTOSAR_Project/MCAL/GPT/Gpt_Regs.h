@@ -23,6 +23,27 @@
 /*****************************************************************************
                         System Control Block Registers
 *****************************************************************************/
+#define NVIC_SYSTEM_INTCTRL_REG   ( *((volatile uint32 *)0xE000ED04) )
 #define NVIC_SYSTEM_PRI3_REG      ( *((volatile uint32 *)0xE000ED20) )
 
+/*****************************************************************************
+                        Debug Registers (DWT Cycle Counter)
+*****************************************************************************/
+#define CORE_DEMCR_REG            ( *((volatile uint32 *)0xE000EDFC) )
+#define DWT_CTRL_REG              ( *((volatile uint32 *)0xE0001000) )
+#define DWT_CYCCNT_REG            ( *((volatile uint32 *)0xE0001004) )
+
+/*****************************************************************************
+                        Wide Timer 0 Registers (64-bit Timestamp)
+*****************************************************************************/
+#define SYSCTL_RCGCWTIMER_REG     ( *((volatile uint32 *)0x400FE65C) )
+#define SYSCTL_PRWTIMER_REG       ( *((volatile uint32 *)0x400FEA5C) )
+#define WTIMER0_CFG_REG           ( *((volatile uint32 *)0x40036000) )
+#define WTIMER0_TAMR_REG          ( *((volatile uint32 *)0x40036004) )
+#define WTIMER0_CTL_REG           ( *((volatile uint32 *)0x4003600C) )
+#define WTIMER0_TAILR_REG         ( *((volatile uint32 *)0x40036028) )
+#define WTIMER0_TBILR_REG         ( *((volatile uint32 *)0x4003602C) )
+#define WTIMER0_TAV_REG           ( *((volatile uint32 *)0x40036050) )
+#define WTIMER0_TBV_REG           ( *((volatile uint32 *)0x40036054) )
+
 #endif /* MCAL_GPT_GPT_REGS_H_ */
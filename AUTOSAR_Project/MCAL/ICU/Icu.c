@@ -0,0 +1,250 @@
+ /******************************************************************************
+ *
+ * Module: ICU
+ *
+ * File Name: Icu.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - ICU Driver.
+ *
+ *              The notification of a channel is its pins bits in the GPIOIM register of its port.
+ *              The port handler reads GPIOMIS once, clears the read edges and calls the notification
+ *              of every channel with a set bit. GPIOIM is written by the tasks and by the notifications
+ *              running in the port handler, so the port interrupt is disabled in the NVIC during the
+ *              read-modify-write.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Icu.h"
+#include "Icu_Regs.h"
+#include "MCAL/IRQ/Irq.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define ICU_IS_REG(BASE)                ( *(volatile uint32 *)((volatile uint8 *)(BASE) + GPIO_IS_REG_OFFSET) )
+#define ICU_IBE_REG(BASE)               ( *(volatile uint32 *)((volatile uint8 *)(BASE) + GPIO_IBE_REG_OFFSET) )
+#define ICU_IEV_REG(BASE)               ( *(volatile uint32 *)((volatile uint8 *)(BASE) + GPIO_IEV_REG_OFFSET) )
+#define ICU_IM_REG(BASE)                ( *(volatile uint32 *)((volatile uint8 *)(BASE) + GPIO_IM_REG_OFFSET) )
+#define ICU_MIS_REG(BASE)               ( *(volatile uint32 *)((volatile uint8 *)(BASE) + GPIO_MIS_REG_OFFSET) )
+#define ICU_ICR_REG(BASE)               ( *(volatile uint32 *)((volatile uint8 *)(BASE) + GPIO_ICR_REG_OFFSET) )
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* Registers base address and interrupt number of each port */
+static volatile uint32 * const g_Icu_Port_Base[ICU_NUMBER_OF_PORTS] =
+{
+    ICU_PORTA_BASE_ADDRESS, ICU_PORTB_BASE_ADDRESS, ICU_PORTC_BASE_ADDRESS,
+    ICU_PORTD_BASE_ADDRESS, ICU_PORTE_BASE_ADDRESS, ICU_PORTF_BASE_ADDRESS
+};
+
+static const Irq_NumberType g_Icu_Port_Irq[ICU_NUMBER_OF_PORTS] =
+{
+    GPIOA_IRQ_NUMBER, GPIOB_IRQ_NUMBER, GPIOC_IRQ_NUMBER,
+    GPIOD_IRQ_NUMBER, GPIOE_IRQ_NUMBER, GPIOF_IRQ_NUMBER
+};
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Icu_PortHandler(uint8 Port);
+
+static void Icu_PortA_Handler(void);
+static void Icu_PortB_Handler(void);
+static void Icu_PortC_Handler(void);
+static void Icu_PortD_Handler(void);
+static void Icu_PortE_Handler(void);
+static void Icu_PortF_Handler(void);
+
+/* Interrupt handler of each port */
+static const Irq_HandlerType g_Icu_Port_Handler[ICU_NUMBER_OF_PORTS] =
+{
+    Icu_PortA_Handler, Icu_PortB_Handler, Icu_PortC_Handler,
+    Icu_PortD_Handler, Icu_PortE_Handler, Icu_PortF_Handler
+};
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Icu_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure the edges of the channels with their notifications disabled
+*              and to install the interrupt handlers of their ports, called after Port_Init.
+************************************************************************************/
+void Icu_Init(void)
+{
+    const Icu_ChannelConfigType * Config_Ptr = NULL_PTR;
+    volatile uint32 * Base_Ptr = NULL_PTR;
+    Icu_ChannelType Channel = 0;
+
+    for(Channel = 0; Channel < ICU_NUMBER_OF_CHANNELS; Channel++)
+    {
+        Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+        Base_Ptr   = g_Icu_Port_Base[Config_Ptr->Port_Num];
+
+        /* The sense and the edges are changed with the pins masked, then the false edges are cleared */
+        ICU_IM_REG(Base_Ptr)  &= ~(uint32)Config_Ptr->Pins_Mask;
+        ICU_IS_REG(Base_Ptr)  &= ~(uint32)Config_Ptr->Pins_Mask;
+        if(ICU_BOTH_EDGES == Config_Ptr->Activation)
+        {
+            ICU_IBE_REG(Base_Ptr) |= Config_Ptr->Pins_Mask;
+        }
+        else
+        {
+            ICU_IBE_REG(Base_Ptr) &= ~(uint32)Config_Ptr->Pins_Mask;
+            if(ICU_RISING_EDGE == Config_Ptr->Activation)
+            {
+                ICU_IEV_REG(Base_Ptr) |= Config_Ptr->Pins_Mask;
+            }
+            else
+            {
+                ICU_IEV_REG(Base_Ptr) &= ~(uint32)Config_Ptr->Pins_Mask;
+            }
+        }
+        ICU_ICR_REG(Base_Ptr) = Config_Ptr->Pins_Mask;
+
+        (void)Irq_InstallHandler(IRQ_PERIPHERAL_VECTOR(g_Icu_Port_Irq[Config_Ptr->Port_Num]),
+                                 g_Icu_Port_Handler[Config_Ptr->Port_Num]);
+        Irq_SetPriority(g_Icu_Port_Irq[Config_Ptr->Port_Num], ICU_INTERRUPT_PRIORITY);
+        Irq_EnableInterrupt(g_Icu_Port_Irq[Config_Ptr->Port_Num]);
+    }
+}
+
+
+/************************************************************************************
+* Service Name: Icu_EnableNotification
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - Channel index
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to discard the edges detected while the notification was disabled
+*              and to enable the notification of the channel.
+************************************************************************************/
+void Icu_EnableNotification(Icu_ChannelType Channel)
+{
+    const Icu_ChannelConfigType * Config_Ptr = NULL_PTR;
+    volatile uint32 * Base_Ptr = NULL_PTR;
+
+    if(Channel < ICU_NUMBER_OF_CHANNELS)
+    {
+        Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+        Base_Ptr   = g_Icu_Port_Base[Config_Ptr->Port_Num];
+
+        Irq_DisableInterrupt(g_Icu_Port_Irq[Config_Ptr->Port_Num]);
+        ICU_ICR_REG(Base_Ptr) = Config_Ptr->Pins_Mask;
+        ICU_IM_REG(Base_Ptr) |= Config_Ptr->Pins_Mask;
+        Irq_EnableInterrupt(g_Icu_Port_Irq[Config_Ptr->Port_Num]);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+
+/************************************************************************************
+* Service Name: Icu_DisableNotification
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - Channel index
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the notification of the channel, it can be called from the
+*              notification itself. The edges are still latched by the hardware.
+************************************************************************************/
+void Icu_DisableNotification(Icu_ChannelType Channel)
+{
+    const Icu_ChannelConfigType * Config_Ptr = NULL_PTR;
+    volatile uint32 * Base_Ptr = NULL_PTR;
+
+    if(Channel < ICU_NUMBER_OF_CHANNELS)
+    {
+        Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+        Base_Ptr   = g_Icu_Port_Base[Config_Ptr->Port_Num];
+
+        Irq_DisableInterrupt(g_Icu_Port_Irq[Config_Ptr->Port_Num]);
+        ICU_IM_REG(Base_Ptr) &= ~(uint32)Config_Ptr->Pins_Mask;
+        Irq_EnableInterrupt(g_Icu_Port_Irq[Config_Ptr->Port_Num]);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Clear the pending edges of a port and call the notifications of their channels */
+static void Icu_PortHandler(uint8 Port)
+{
+    const Icu_ChannelConfigType * Config_Ptr = NULL_PTR;
+    Icu_ChannelType Channel = 0;
+    uint32 status = ICU_MIS_REG(g_Icu_Port_Base[Port]);
+
+    /* Cleared before the notifications so an edge during them interrupts again */
+    ICU_ICR_REG(g_Icu_Port_Base[Port]) = status;
+
+    for(Channel = 0; Channel < ICU_NUMBER_OF_CHANNELS; Channel++)
+    {
+        Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+        if((Port == Config_Ptr->Port_Num) && (0 != (status & Config_Ptr->Pins_Mask))
+           && (NULL_PTR != Config_Ptr->Notification_Ptr))
+        {
+            Config_Ptr->Notification_Ptr();
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+}
+
+/************************************************************************************/
+
+static void Icu_PortA_Handler(void)
+{
+    Icu_PortHandler(0U);
+}
+
+static void Icu_PortB_Handler(void)
+{
+    Icu_PortHandler(1U);
+}
+
+static void Icu_PortC_Handler(void)
+{
+    Icu_PortHandler(2U);
+}
+
+static void Icu_PortD_Handler(void)
+{
+    Icu_PortHandler(3U);
+}
+
+static void Icu_PortE_Handler(void)
+{
+    Icu_PortHandler(4U);
+}
+
+static void Icu_PortF_Handler(void)
+{
+    Icu_PortHandler(5U);
+}
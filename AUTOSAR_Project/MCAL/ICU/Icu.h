@@ -0,0 +1,120 @@
+ /******************************************************************************
+ *
+ * Module: ICU
+ *
+ * File Name: Icu.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - ICU Driver.
+ *              Edge detection on the GPIO pins, a channel is a group of pins of one port
+ *              (the GPIO interrupt is shared by the port) with one edge and one notification.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef ICU_H
+#define ICU_H
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Std_Types.h"
+
+/* ICU Pre-Compile Configuration Header file */
+#include "Icu_Cfg.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Number of the GPIO ports (PORTA to PORTF) */
+#define ICU_NUMBER_OF_PORTS                 (6U)
+
+/* GPIO port peripheral interrupt numbers */
+#define GPIOA_IRQ_NUMBER                    (0U)
+#define GPIOB_IRQ_NUMBER                    (1U)
+#define GPIOC_IRQ_NUMBER                    (2U)
+#define GPIOD_IRQ_NUMBER                    (3U)
+#define GPIOE_IRQ_NUMBER                    (4U)
+#define GPIOF_IRQ_NUMBER                    (30U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Icu_ChannelType used by the ICU APIs (index in the channels table) */
+typedef uint8 Icu_ChannelType;
+
+/* Description: Enum to hold the edges detected by a channel */
+typedef enum
+{
+    ICU_FALLING_EDGE, ICU_RISING_EDGE, ICU_BOTH_EDGES
+}Icu_ActivationType;
+
+/* Description: Structure to configure each channel:
+ *  1. The GPIO port (0 = PORTA to 5 = PORTF).
+ *  2. Mask of the pins of the port.
+ *  3. The detected edges.
+ *  4. Notification called from the port interrupt when one of the pins detects an edge.
+ */
+typedef struct
+{
+    uint8 Port_Num;
+    uint8 Pins_Mask;
+    Icu_ActivationType Activation;
+    void (*Notification_Ptr)(void);
+}Icu_ChannelConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Icu_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure the edges of the channels with their notifications disabled
+*              and to install the interrupt handlers of their ports, called after Port_Init.
+************************************************************************************/
+void Icu_Init(void);
+
+
+/************************************************************************************
+* Service Name: Icu_EnableNotification
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - Channel index
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to discard the edges detected while the notification was disabled
+*              and to enable the notification of the channel.
+************************************************************************************/
+void Icu_EnableNotification(Icu_ChannelType Channel);
+
+
+/************************************************************************************
+* Service Name: Icu_DisableNotification
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Channel - Channel index
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the notification of the channel, it can be called from the
+*              notification itself. The edges are still latched by the hardware.
+************************************************************************************/
+void Icu_DisableNotification(Icu_ChannelType Channel);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Icu */
+extern const Icu_ChannelConfigType Icu_ChannelsConfigurations[ICU_NUMBER_OF_CHANNELS];
+
+#endif /* ICU_H */
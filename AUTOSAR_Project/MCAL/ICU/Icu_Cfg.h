@@ -0,0 +1,24 @@
+ /******************************************************************************
+ *
+ * Module: ICU
+ *
+ * File Name: Icu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - ICU Driver
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef ICU_CFG_H_
+#define ICU_CFG_H_
+
+/* Number of the configured channels in the array of structures in Icu_PBcfg.c */
+#define ICU_NUMBER_OF_CHANNELS              (1U)
+
+/* NVIC priority of the GPIO port interrupts (0 is the highest, 7 is the lowest) */
+#define ICU_INTERRUPT_PRIORITY              (5U)
+
+/* Channel Index in the array of structures in Icu_PBcfg.c */
+#define IcuConf_SW1_CHANNEL_ID              (uint8)0x00
+
+#endif /* ICU_CFG_H_ */
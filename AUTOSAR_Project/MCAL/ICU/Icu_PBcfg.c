@@ -0,0 +1,25 @@
+ /******************************************************************************
+ *
+ * Module: ICU
+ *
+ * File Name: Icu_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - ICU Driver
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "Icu.h"
+#include "MCAL/Dio/Dio.h"
+#include "ECUAL/Button/Button.h"
+
+/* Array of structure that hold the configuration of each channel:
+ * 1. The GPIO port.
+ * 2. Mask of the pins.
+ * 3. The detected edges.
+ * 4. Notification called from the port interrupt. */
+const Icu_ChannelConfigType Icu_ChannelsConfigurations[ICU_NUMBER_OF_CHANNELS] =
+{
+     { (uint8)DioConf_SW1_PORT_NUM, (uint8)(1U << DioConf_SW1_CHANNEL_NUM), ICU_BOTH_EDGES,
+       Button_EdgeNotification }                                         /* SW1 (PF4) press and release */
+};
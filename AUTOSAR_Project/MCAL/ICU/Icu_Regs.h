@@ -0,0 +1,38 @@
+ /******************************************************************************
+ *
+ * Module: ICU
+ *
+ * File Name: Icu_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - ICU Driver Registers
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef MCAL_ICU_ICU_REGS_H_
+#define MCAL_ICU_ICU_REGS_H_
+
+#include "Std_Types.h"
+
+/******************************************************************************
+ *                          Ports registers base address                      *
+ ******************************************************************************/
+#define ICU_PORTA_BASE_ADDRESS              ( (volatile uint32*)0x40004000 )
+#define ICU_PORTB_BASE_ADDRESS              ( (volatile uint32*)0x40005000 )
+#define ICU_PORTC_BASE_ADDRESS              ( (volatile uint32*)0x40006000 )
+#define ICU_PORTD_BASE_ADDRESS              ( (volatile uint32*)0x40007000 )
+#define ICU_PORTE_BASE_ADDRESS              ( (volatile uint32*)0x40024000 )
+#define ICU_PORTF_BASE_ADDRESS              ( (volatile uint32*)0x40025000 )
+
+/******************************************************************************
+ *                              Register Offsets                              *
+ ******************************************************************************/
+#define GPIO_IS_REG_OFFSET              ( 0X404 )   /* Interrupt sense, 0 = edge */
+#define GPIO_IBE_REG_OFFSET             ( 0X408 )   /* Interrupt both edges */
+#define GPIO_IEV_REG_OFFSET             ( 0X40C )   /* Interrupt event, 1 = rising edge */
+#define GPIO_IM_REG_OFFSET              ( 0X410 )   /* Interrupt mask, 1 = sent to the NVIC */
+#define GPIO_RIS_REG_OFFSET             ( 0X414 )   /* Raw interrupt status */
+#define GPIO_MIS_REG_OFFSET             ( 0X418 )   /* Masked interrupt status */
+#define GPIO_ICR_REG_OFFSET             ( 0X41C )   /* Interrupt clear, write 1 to clear */
+
+#endif /* MCAL_ICU_ICU_REGS_H_ */
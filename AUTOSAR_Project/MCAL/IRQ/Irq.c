@@ -0,0 +1,180 @@
+ /******************************************************************************
+ *
+ * Module: IRQ
+ *
+ * File Name: Irq.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Interrupt Manager.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Irq.h"
+#include "Irq_Regs.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Complete the table writes before the VTOR is changed, and use the new VTOR by the next instructions */
+#define Data_Sync_Barrier()             __asm(" DSB")
+#define Instruction_Sync_Barrier()      __asm(" ISB")
+
+#define IRQ_REG_BITS                    32U
+#define IRQ_PRIORITY_BITS_POS           (8U - IRQ_PRIORITY_BITS)
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* The flash vector table defined in tm4c123gh6pm_startup_ccs.c */
+extern void (* const g_pfnVectors[])(void);
+
+/*
+ * The RAM vector table, the linker command file places the .vtable section at the start of the SRAM.
+ * The VTOR needs the table aligned to its size rounded up to a power of 2 (155 vectors -> 1024 bytes).
+ */
+#pragma DATA_SECTION(g_Irq_Ram_Vectors, ".vtable")
+#pragma DATA_ALIGN(g_Irq_Ram_Vectors, 1024)
+static Irq_HandlerType g_Irq_Ram_Vectors[IRQ_NUMBER_OF_VECTORS];
+
+static boolean g_Irq_Initialized = FALSE;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Irq_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to copy the flash vector table to the SRAM (.vtable section) and
+*              to move the VTOR to it, the handlers are the same until a driver installs one.
+************************************************************************************/
+void Irq_Init(void)
+{
+    Irq_VectorType Vector = 0;
+
+    /* Both tables have the same handlers so the interrupts can stay enabled during the switch */
+    for(Vector = 0; Vector < IRQ_NUMBER_OF_VECTORS; Vector++)
+    {
+        g_Irq_Ram_Vectors[Vector] = g_pfnVectors[Vector];
+    }
+    Data_Sync_Barrier();
+    NVIC_VTABLE_REG = (uint32)g_Irq_Ram_Vectors;
+    Data_Sync_Barrier();
+    Instruction_Sync_Barrier();
+
+    g_Irq_Initialized = TRUE;
+}
+
+
+/************************************************************************************
+* Service Name: Irq_InstallHandler
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Vector number (IRQ_VECTOR_SYSTICK or IRQ_PERIPHERAL_VECTOR)
+*                  Handler - Interrupt handler
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the vector is invalid or Irq_Init is not called
+* Description: Function to install an interrupt handler in the RAM vector table, the
+*              exception entry branches to it directly.
+************************************************************************************/
+Std_ReturnType Irq_InstallHandler(Irq_VectorType Vector, Irq_HandlerType Handler)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    /* The stack pointer and the reset vector (0 and 1) are never changed */
+    if((TRUE == g_Irq_Initialized) && (Vector > 1) && (Vector < IRQ_NUMBER_OF_VECTORS) && (NULL_PTR != Handler))
+    {
+        /* A single word write, the exception entry reads the old or the new handler */
+        g_Irq_Ram_Vectors[Vector] = Handler;
+        Data_Sync_Barrier();
+        ret = E_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+
+/************************************************************************************
+* Service Name: Irq_EnableInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): IrqNumber - Peripheral interrupt number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable a peripheral interrupt in the NVIC.
+************************************************************************************/
+void Irq_EnableInterrupt(Irq_NumberType IrqNumber)
+{
+    /* Writing 1 enables the interrupt, the 0 bits have no effect so no read-modify-write is needed */
+    NVIC_EN_REG(IrqNumber / IRQ_REG_BITS) = (uint32)1 << (IrqNumber % IRQ_REG_BITS);
+}
+
+
+/************************************************************************************
+* Service Name: Irq_DisableInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): IrqNumber - Peripheral interrupt number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable a peripheral interrupt in the NVIC.
+************************************************************************************/
+void Irq_DisableInterrupt(Irq_NumberType IrqNumber)
+{
+    NVIC_DIS_REG(IrqNumber / IRQ_REG_BITS) = (uint32)1 << (IrqNumber % IRQ_REG_BITS);
+    Data_Sync_Barrier();
+    Instruction_Sync_Barrier();
+}
+
+
+/************************************************************************************
+* Service Name: Irq_SetPending
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): IrqNumber - Peripheral interrupt number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to request a peripheral interrupt by software, its handler runs
+*              as soon as the priority allows it if the interrupt is enabled.
+************************************************************************************/
+void Irq_SetPending(Irq_NumberType IrqNumber)
+{
+    /* Writing 1 sets only the pending bit of this interrupt, no read-modify-write is needed */
+    NVIC_PEND_REG(IrqNumber / IRQ_REG_BITS) = (uint32)1 << (IrqNumber % IRQ_REG_BITS);
+}
+
+
+/************************************************************************************
+* Service Name: Irq_SetPriority
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): IrqNumber - Peripheral interrupt number
+*                  Priority - Priority level (0 is the highest, 7 is the lowest)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the priority of a peripheral interrupt in the NVIC.
+************************************************************************************/
+void Irq_SetPriority(Irq_NumberType IrqNumber, uint8 Priority)
+{
+    /* The priority registers are byte accessible, the priority is in the upper bits of the byte */
+    NVIC_PRI_BYTE_REG(IrqNumber) = (uint8)(Priority << IRQ_PRIORITY_BITS_POS);
+}
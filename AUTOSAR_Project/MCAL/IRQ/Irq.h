@@ -0,0 +1,135 @@
+ /******************************************************************************
+ *
+ * Module: IRQ
+ *
+ * File Name: Irq.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Interrupt Manager.
+ *              The vector table is copied to SRAM so the drivers install their handlers
+ *              directly in it instead of calling them from a handler in the startup file.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef IRQ_H
+#define IRQ_H
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Std_Types.h"
+
+/* IRQ Pre-Compile Configuration Header file */
+#include "Irq_Cfg.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Vector number of the SysTick exception */
+#define IRQ_VECTOR_SYSTICK                  (Irq_VectorType)15
+
+/* Vector number of a peripheral interrupt (the interrupt number in the data sheet) */
+#define IRQ_PERIPHERAL_VECTOR(IRQ_NUMBER)   ((Irq_VectorType)((IRQ_NUMBER) + 16U))
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Irq_VectorType used by Irq_InstallHandler (index in the vector table) */
+typedef uint8 Irq_VectorType;
+
+/* Type definition for Irq_NumberType used by the NVIC APIs (peripheral interrupt number) */
+typedef uint8 Irq_NumberType;
+
+/* Type definition for Irq_HandlerType, an interrupt handler */
+typedef void (*Irq_HandlerType)(void);
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Irq_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to copy the flash vector table to the SRAM (.vtable section) and
+*              to move the VTOR to it, the handlers are the same until a driver installs one.
+************************************************************************************/
+void Irq_Init(void);
+
+
+/************************************************************************************
+* Service Name: Irq_InstallHandler
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): Vector - Vector number (IRQ_VECTOR_SYSTICK or IRQ_PERIPHERAL_VECTOR)
+*                  Handler - Interrupt handler
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the vector is invalid or Irq_Init is not called
+* Description: Function to install an interrupt handler in the RAM vector table, the
+*              exception entry branches to it directly.
+************************************************************************************/
+Std_ReturnType Irq_InstallHandler(Irq_VectorType Vector, Irq_HandlerType Handler);
+
+
+/************************************************************************************
+* Service Name: Irq_EnableInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): IrqNumber - Peripheral interrupt number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable a peripheral interrupt in the NVIC.
+************************************************************************************/
+void Irq_EnableInterrupt(Irq_NumberType IrqNumber);
+
+
+/************************************************************************************
+* Service Name: Irq_DisableInterrupt
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): IrqNumber - Peripheral interrupt number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable a peripheral interrupt in the NVIC.
+************************************************************************************/
+void Irq_DisableInterrupt(Irq_NumberType IrqNumber);
+
+
+/************************************************************************************
+* Service Name: Irq_SetPending
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): IrqNumber - Peripheral interrupt number
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to request a peripheral interrupt by software, its handler runs
+*              as soon as the priority allows it if the interrupt is enabled.
+************************************************************************************/
+void Irq_SetPending(Irq_NumberType IrqNumber);
+
+
+/************************************************************************************
+* Service Name: Irq_SetPriority
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): IrqNumber - Peripheral interrupt number
+*                  Priority - Priority level (0 is the highest, 7 is the lowest)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the priority of a peripheral interrupt in the NVIC.
+************************************************************************************/
+void Irq_SetPriority(Irq_NumberType IrqNumber, uint8 Priority);
+
+#endif /* IRQ_H */
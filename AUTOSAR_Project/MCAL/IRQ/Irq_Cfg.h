@@ -0,0 +1,21 @@
+ /******************************************************************************
+ *
+ * Module: IRQ
+ *
+ * File Name: Irq_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Interrupt Manager.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef IRQ_CFG_H_
+#define IRQ_CFG_H_
+
+/* Number of the vectors in g_pfnVectors (tm4c123gh6pm_startup_ccs.c): 16 core exceptions + 139 interrupts */
+#define IRQ_NUMBER_OF_VECTORS               (155U)
+
+/* Number of the implemented priority bits in the NVIC priority registers */
+#define IRQ_PRIORITY_BITS                   (3U)
+
+#endif /* IRQ_CFG_H_ */
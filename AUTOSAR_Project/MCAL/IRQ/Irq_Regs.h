@@ -0,0 +1,35 @@
+ /******************************************************************************
+ *
+ * Module: IRQ
+ *
+ * File Name: Irq_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Interrupt Manager Registers
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef MCAL_IRQ_IRQ_REGS_H_
+#define MCAL_IRQ_IRQ_REGS_H_
+
+#include "Std_Types.h"
+
+/*****************************************************************************
+                        NVIC Registers
+*****************************************************************************/
+/* Enable/Disable register of the interrupts 32*N to 32*N+31 */
+#define NVIC_EN_REG(N)            ( ((volatile uint32 *)0xE000E100)[N] )
+#define NVIC_DIS_REG(N)           ( ((volatile uint32 *)0xE000E180)[N] )
+
+/* Set pending register of the interrupts 32*N to 32*N+31 */
+#define NVIC_PEND_REG(N)          ( ((volatile uint32 *)0xE000E200)[N] )
+
+/* Priority byte of the interrupt N */
+#define NVIC_PRI_BYTE_REG(N)      ( ((volatile uint8 *)0xE000E400)[N] )
+
+/*****************************************************************************
+                        System Control Block Registers
+*****************************************************************************/
+#define NVIC_VTABLE_REG           ( *((volatile uint32 *)0xE000ED08) )
+
+#endif /* MCAL_IRQ_IRQ_REGS_H_ */
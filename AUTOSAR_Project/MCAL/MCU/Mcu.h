@@ -14,6 +14,7 @@
 #define MCU_H_
 
 #include "Std_Types.h"
+#include "Mcu_Cfg.h"
 
 void Mcu_Init(void);
 
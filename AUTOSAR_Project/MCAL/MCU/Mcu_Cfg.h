@@ -0,0 +1,21 @@
+ /******************************************************************************
+ *
+ * Module: MCU
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H_
+#define MCU_CFG_H_
+
+/*
+ * System clock frequency in Hz, Mcu_Init keeps the reset clock (the 16 MHz PIOSC). The GPT, UART and PWM
+ * clocks are derived from it, change it here only.
+ */
+#define MCU_SYSTEM_CLOCK_HZ                 (16000000UL)
+
+#endif /* MCU_CFG_H_ */
@@ -0,0 +1,305 @@
+ /******************************************************************************
+ *
+ * Module: PWM
+ *
+ * File Name: Pwm.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - PWM Driver.
+ *
+ *              The generators count down from the load value (period - 1) to 0, an output is
+ *              driven to the active level at the load and back at its comparator, the signal is
+ *              produced by the hardware without any interrupt. The 0% and 100% duty cycles have
+ *              no comparator match, the output action is then only at the load.
+ *
+ *              The load, comparator and action registers of the generators are globally
+ *              synchronized: the written values wait in the hardware until the GLOBALSYNC bit of
+ *              their generator is set in the PWM1CTL register, then they are applied together at
+ *              the end of the current period. Pwm_ApplyUpdates sets the bits of all the staged
+ *              generators in one write so several channels change in the same period.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Pwm.h"
+#include "Pwm_Regs.h"
+#include "Common_Macros.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define PWM1_CLOCK_MASK                 0x00000002         // PWM Module 1 bit mask in RCGCPWM and PRPWM registers.
+#define PWM_GEN_CTL_ENABLE              0x00000001         // Generator enable bit in CTL register.
+#define PWM_GEN_CTL_GLOBAL_SYNC_UPDATES 0x000003F8         // Load, comparators and actions updated by the global sync in CTL register.
+#define PWM_GEN_ACT_LOAD_HIGH           0x0000000C         // Drive the output high at the load in GENA and GENB registers.
+#define PWM_GEN_ACT_LOAD_LOW            0x00000008         // Drive the output low at the load in GENA and GENB registers.
+#define PWM_GENA_ACT_CMPA_DOWN_LOW      0x00000080         // Drive the output A low at the comparator A while counting down.
+#define PWM_GENB_ACT_CMPB_DOWN_LOW      0x00000800         // Drive the output B low at the comparator B while counting down.
+
+#define PWM_GEN_REG(GEN, OFFSET)        ( *(volatile uint32 *)(PWM1_GEN0_BASE_ADDRESS + ((GEN) * PWM_GEN_ADDRESS_STEP) + (OFFSET)) )
+
+/* PWM signal number of a channel in the ENABLE and INVERT registers (2 signals per generator) */
+#define PWM_SIGNAL_MASK(CONFIG_PTR)     ( (uint32)1U << (((CONFIG_PTR)->Generator * 2U) + (uint32)(CONFIG_PTR)->Output) )
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* Period of each generator and duty cycle of each channel, the comparators are computed from both */
+static Pwm_PeriodType g_Pwm_Period[PWM_NUMBER_OF_GENERATORS];
+static uint16 g_Pwm_Duty_Cycle[PWM_NUMBER_OF_CHANNELS];
+
+/* Generators with updates written and not applied yet (bit n for the generator n) */
+static uint8 g_Pwm_Staged_Generators = 0;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Pwm_WriteChannel(Pwm_ChannelType ChannelNumber);
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Pwm_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the generators of the channels with their configured period,
+*              duty cycle and polarity. The counters of the generators are reset together so the
+*              generators with the same period start their periods at the same time.
+************************************************************************************/
+void Pwm_Init(void)
+{
+    const Pwm_ChannelConfigType * Config_Ptr = NULL_PTR;
+    Pwm_ChannelType Channel = 0;
+    uint8 Generators = 0;
+    uint8 Gen = 0;
+
+    /* Enable clock for PWM Module 1 and wait for clock to start */
+    SYSCTL_RCGCPWM_REG |= PWM1_CLOCK_MASK;
+    while(!(SYSCTL_PRPWM_REG & PWM1_CLOCK_MASK));
+
+    for(Channel = 0; Channel < PWM_NUMBER_OF_CHANNELS; Channel++)
+    {
+        Config_Ptr = &Pwm_ChannelsConfigurations[Channel];
+        g_Pwm_Period[Config_Ptr->Generator] = Config_Ptr->Period;
+        g_Pwm_Duty_Cycle[Channel]           = Config_Ptr->Duty_Cycle;
+        Generators |= (uint8)(1U << Config_Ptr->Generator);
+    }
+
+    /* The generators are disabled while they are configured, their registers are then written directly */
+    for(Gen = 0; Gen < PWM_NUMBER_OF_GENERATORS; Gen++)
+    {
+        if(BIT_IS_SET(Generators, Gen))
+        {
+            PWM_GEN_REG(Gen, PWM_GEN_CTL_REG_OFFSET)  = 0;
+            PWM_GEN_REG(Gen, PWM_GEN_LOAD_REG_OFFSET) = (uint32)g_Pwm_Period[Gen] - 1U;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+
+    for(Channel = 0; Channel < PWM_NUMBER_OF_CHANNELS; Channel++)
+    {
+        Config_Ptr = &Pwm_ChannelsConfigurations[Channel];
+        Pwm_WriteChannel(Channel);
+        if(PWM_LOW == Config_Ptr->Polarity)
+        {
+            PWM1_INVERT_REG |= PWM_SIGNAL_MASK(Config_Ptr);
+        }
+        else
+        {
+            PWM1_INVERT_REG &= ~PWM_SIGNAL_MASK(Config_Ptr);
+        }
+    }
+
+    for(Gen = 0; Gen < PWM_NUMBER_OF_GENERATORS; Gen++)
+    {
+        if(BIT_IS_SET(Generators, Gen))
+        {
+            PWM_GEN_REG(Gen, PWM_GEN_CTL_REG_OFFSET) = PWM_GEN_CTL_GLOBAL_SYNC_UPDATES | PWM_GEN_CTL_ENABLE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    PWM1_SYNC_REG = Generators;
+    g_Pwm_Staged_Generators = 0;
+
+    for(Channel = 0; Channel < PWM_NUMBER_OF_CHANNELS; Channel++)
+    {
+        PWM1_ENABLE_REG |= PWM_SIGNAL_MASK(&Pwm_ChannelsConfigurations[Channel]);
+    }
+}
+
+
+/************************************************************************************
+* Service Name: Pwm_SetDutyCycle
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelNumber - Channel index
+*                  DutyCycle - Duty cycle from 0x0000 to PWM_DUTY_MAX
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the duty cycle of a channel, it is applied by the hardware at the
+*              end of the current period so the output never has a partial period.
+************************************************************************************/
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    Pwm_StageDutyCycle(ChannelNumber, DutyCycle);
+    Pwm_ApplyUpdates();
+}
+
+
+/************************************************************************************
+* Service Name: Pwm_SetPeriodAndDuty
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelNumber - Channel index
+*                  Period - Period in PWM clocks (2 to 65535)
+*                  DutyCycle - Duty cycle from 0x0000 to PWM_DUTY_MAX
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the period of the generator of a channel and the duty cycle of the
+*              channel, the other channel of the generator keeps its duty cycle. They are applied
+*              together by the hardware at the end of the current period.
+************************************************************************************/
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16 DutyCycle)
+{
+    Pwm_ChannelType Channel = 0;
+    uint8 Gen = 0;
+
+    if((ChannelNumber < PWM_NUMBER_OF_CHANNELS) && (Period >= 2U))
+    {
+        Gen = Pwm_ChannelsConfigurations[ChannelNumber].Generator;
+        g_Pwm_Period[Gen] = Period;
+        g_Pwm_Duty_Cycle[ChannelNumber] = DutyCycle;
+        PWM_GEN_REG(Gen, PWM_GEN_LOAD_REG_OFFSET) = (uint32)Period - 1U;
+
+        /* The comparators of both outputs are relative to the period */
+        for(Channel = 0; Channel < PWM_NUMBER_OF_CHANNELS; Channel++)
+        {
+            if(Gen == Pwm_ChannelsConfigurations[Channel].Generator)
+            {
+                Pwm_WriteChannel(Channel);
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+        g_Pwm_Staged_Generators |= (uint8)(1U << Gen);
+        Pwm_ApplyUpdates();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+
+/************************************************************************************
+* Service Name: Pwm_StageDutyCycle
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelNumber - Channel index
+*                  DutyCycle - Duty cycle from 0x0000 to PWM_DUTY_MAX
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write the duty cycle of a channel without applying it, the staged
+*              duty cycles of all the channels are applied together by Pwm_ApplyUpdates.
+************************************************************************************/
+void Pwm_StageDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    if(ChannelNumber < PWM_NUMBER_OF_CHANNELS)
+    {
+        g_Pwm_Duty_Cycle[ChannelNumber] = DutyCycle;
+        Pwm_WriteChannel(ChannelNumber);
+        g_Pwm_Staged_Generators |= (uint8)(1U << Pwm_ChannelsConfigurations[ChannelNumber].Generator);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+
+/************************************************************************************
+* Service Name: Pwm_ApplyUpdates
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to apply the staged updates of all the generators with one register write,
+*              the generators with the same period change in the same period.
+************************************************************************************/
+void Pwm_ApplyUpdates(void)
+{
+    if(0 != g_Pwm_Staged_Generators)
+    {
+        /* The GLOBALSYNC bits are cleared by the hardware when the updates are applied */
+        PWM1_CTL_REG |= g_Pwm_Staged_Generators;
+        g_Pwm_Staged_Generators = 0;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Write the comparator and the output actions of a channel from its duty cycle and the period of its generator */
+static void Pwm_WriteChannel(Pwm_ChannelType ChannelNumber)
+{
+    const Pwm_ChannelConfigType * Config_Ptr = &Pwm_ChannelsConfigurations[ChannelNumber];
+    uint32 period = g_Pwm_Period[Config_Ptr->Generator];
+    uint32 active = ((uint32)g_Pwm_Duty_Cycle[ChannelNumber] * period) / PWM_DUTY_MAX;    /* PWM clocks at the active level */
+    uint32 compare = 0;
+    uint32 actions = 0;
+
+    if(0U == active)
+    {
+        actions = PWM_GEN_ACT_LOAD_LOW;
+    }
+    else if(active >= period)
+    {
+        actions = PWM_GEN_ACT_LOAD_HIGH;
+    }
+    else
+    {
+        /* The output is high from the load (period - 1) down to the comparator */
+        compare = (period - 1U) - active;
+        actions = PWM_GEN_ACT_LOAD_HIGH
+                | ((PWM_OUTPUT_A == Config_Ptr->Output) ? PWM_GENA_ACT_CMPA_DOWN_LOW : PWM_GENB_ACT_CMPB_DOWN_LOW);
+    }
+
+    if(PWM_OUTPUT_A == Config_Ptr->Output)
+    {
+        PWM_GEN_REG(Config_Ptr->Generator, PWM_GEN_CMPA_REG_OFFSET) = compare;
+        PWM_GEN_REG(Config_Ptr->Generator, PWM_GEN_GENA_REG_OFFSET) = actions;
+    }
+    else
+    {
+        PWM_GEN_REG(Config_Ptr->Generator, PWM_GEN_CMPB_REG_OFFSET) = compare;
+        PWM_GEN_REG(Config_Ptr->Generator, PWM_GEN_GENB_REG_OFFSET) = actions;
+    }
+}
@@ -0,0 +1,160 @@
+ /******************************************************************************
+ *
+ * Module: PWM
+ *
+ * File Name: Pwm.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - PWM Driver.
+ *              Channels of PWM Module 1, each channel is the output A or B of a generator
+ *              (the two outputs of a generator share its period). The pins are routed to the
+ *              channels by the Port Driver (Port_Init or Port_SetPinMode).
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef PWM_H
+#define PWM_H
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Std_Types.h"
+
+/* PWM Pre-Compile Configuration Header file */
+#include "Pwm_Cfg.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Number of the generators of a PWM module */
+#define PWM_NUMBER_OF_GENERATORS            (4U)
+
+/* Duty cycle of 100%, the duty cycles are from 0x0000 (0%) to PWM_DUTY_MAX */
+#define PWM_DUTY_MAX                        (uint16)0x8000
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Pwm_ChannelType used by the PWM APIs (index in the channels table) */
+typedef uint8 Pwm_ChannelType;
+
+/* Type definition for Pwm_PeriodType used by the PWM APIs (period in PWM clocks, 2 to 65535) */
+typedef uint16 Pwm_PeriodType;
+
+/* Description: Enum to hold the output of a generator driving a channel */
+typedef enum
+{
+    PWM_OUTPUT_A, PWM_OUTPUT_B
+}Pwm_GeneratorOutputType;
+
+/* Description: Enum to hold the level of the active part (the duty cycle) of a channel */
+typedef enum
+{
+    PWM_LOW, PWM_HIGH
+}Pwm_OutputStateType;
+
+/* Description: Structure to configure each channel:
+ *  1. The generator (0 to 3) and its output.
+ *  2. The level of the duty cycle part, PWM_LOW inverts the output.
+ *  3. The period in PWM clocks, the two channels of a generator MUST have the same period.
+ *  4. The duty cycle set by Pwm_Init.
+ */
+typedef struct
+{
+    uint8 Generator;
+    Pwm_GeneratorOutputType Output;
+    Pwm_OutputStateType Polarity;
+    Pwm_PeriodType Period;
+    uint16 Duty_Cycle;
+}Pwm_ChannelConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Pwm_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the generators of the channels with their configured period,
+*              duty cycle and polarity. The counters of the generators are reset together so the
+*              generators with the same period start their periods at the same time.
+************************************************************************************/
+void Pwm_Init(void);
+
+
+/************************************************************************************
+* Service Name: Pwm_SetDutyCycle
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelNumber - Channel index
+*                  DutyCycle - Duty cycle from 0x0000 to PWM_DUTY_MAX
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the duty cycle of a channel, it is applied by the hardware at the
+*              end of the current period so the output never has a partial period.
+************************************************************************************/
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle);
+
+
+/************************************************************************************
+* Service Name: Pwm_SetPeriodAndDuty
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelNumber - Channel index
+*                  Period - Period in PWM clocks (2 to 65535)
+*                  DutyCycle - Duty cycle from 0x0000 to PWM_DUTY_MAX
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the period of the generator of a channel and the duty cycle of the
+*              channel, the other channel of the generator keeps its duty cycle. They are applied
+*              together by the hardware at the end of the current period.
+************************************************************************************/
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16 DutyCycle);
+
+
+/************************************************************************************
+* Service Name: Pwm_StageDutyCycle
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelNumber - Channel index
+*                  DutyCycle - Duty cycle from 0x0000 to PWM_DUTY_MAX
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write the duty cycle of a channel without applying it, the staged
+*              duty cycles of all the channels are applied together by Pwm_ApplyUpdates.
+************************************************************************************/
+void Pwm_StageDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle);
+
+
+/************************************************************************************
+* Service Name: Pwm_ApplyUpdates
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to apply the staged updates of all the generators with one register write,
+*              the generators with the same period change in the same period.
+************************************************************************************/
+void Pwm_ApplyUpdates(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Pwm */
+extern const Pwm_ChannelConfigType Pwm_ChannelsConfigurations[PWM_NUMBER_OF_CHANNELS];
+
+#endif /* PWM_H */
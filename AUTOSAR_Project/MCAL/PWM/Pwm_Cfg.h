@@ -0,0 +1,31 @@
+ /******************************************************************************
+ *
+ * Module: PWM
+ *
+ * File Name: Pwm_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - PWM Driver
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef PWM_CFG_H_
+#define PWM_CFG_H_
+
+#include "MCAL/MCU/Mcu_Cfg.h"
+
+/* PWM clock, the system clock without the PWM divider */
+#define PWM_CLOCK_HZ                        MCU_SYSTEM_CLOCK_HZ
+
+/* Frequency of the LED channels, high enough to never flicker (the period is up to 65535 PWM clocks) */
+#define PWM_LED_FREQUENCY_HZ                (1000UL)
+
+/* Number of the configured channels in the array of structures in Pwm_PBcfg.c */
+#define PWM_NUMBER_OF_CHANNELS              (3U)
+
+/* Channel Index in the array of structures in Pwm_PBcfg.c */
+#define PwmConf_LED1_CHANNEL_ID             (uint8)0x00     /* M1PWM5 on PF1 */
+#define PwmConf_LED2_CHANNEL_ID             (uint8)0x01     /* M1PWM6 on PF2 */
+#define PwmConf_LED3_CHANNEL_ID             (uint8)0x02     /* M1PWM7 on PF3 */
+
+#endif /* PWM_CFG_H_ */
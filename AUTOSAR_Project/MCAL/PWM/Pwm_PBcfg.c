@@ -0,0 +1,31 @@
+ /******************************************************************************
+ *
+ * Module: PWM
+ *
+ * File Name: Pwm_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - PWM Driver
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "Pwm.h"
+
+/* Period of the LED channels in PWM clocks */
+#define PWM_LED_PERIOD                      ((Pwm_PeriodType)(PWM_CLOCK_HZ / PWM_LED_FREQUENCY_HZ))
+
+#if ((PWM_CLOCK_HZ / PWM_LED_FREQUENCY_HZ) < 2UL) || ((PWM_CLOCK_HZ / PWM_LED_FREQUENCY_HZ) > 65535UL)
+#error "PWM_LED_FREQUENCY_HZ gives a period out of the 16-bit counter range"
+#endif
+
+/* Array of structure that hold the configuration of each channel:
+ * 1. The generator and its output (M1PWMn is the output A of the generator n / 2 for an even n, else B).
+ * 2. The level of the duty cycle part, the level turning the LED ON.
+ * 3. The period, the same for the two channels of a generator.
+ * 4. The initial duty cycle. */
+const Pwm_ChannelConfigType Pwm_ChannelsConfigurations[PWM_NUMBER_OF_CHANNELS] =
+{
+     { 2U, PWM_OUTPUT_B, PWM_HIGH, PWM_LED_PERIOD, 0U },   /* M1PWM5: LED1 (PF1 red)   */
+     { 3U, PWM_OUTPUT_A, PWM_HIGH, PWM_LED_PERIOD, 0U },   /* M1PWM6: LED2 (PF2 blue)  */
+     { 3U, PWM_OUTPUT_B, PWM_HIGH, PWM_LED_PERIOD, 0U }    /* M1PWM7: LED3 (PF3 green) */
+};
@@ -0,0 +1,45 @@
+ /******************************************************************************
+ *
+ * Module: PWM
+ *
+ * File Name: Pwm_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - PWM Driver Registers
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef MCAL_PWM_PWM_REGS_H_
+#define MCAL_PWM_PWM_REGS_H_
+
+#include "Std_Types.h"
+
+/*****************************************************************************
+                        System Control Registers
+*****************************************************************************/
+#define SYSCTL_RCGCPWM_REG        ( *((volatile uint32 *)0x400FE640) )
+#define SYSCTL_PRPWM_REG          ( *((volatile uint32 *)0x400FEA40) )
+
+/*****************************************************************************
+                        PWM Module 1 Registers
+*****************************************************************************/
+#define PWM1_CTL_REG              ( *((volatile uint32 *)0x40029000) )   /* Global sync of the generators updates */
+#define PWM1_SYNC_REG             ( *((volatile uint32 *)0x40029004) )   /* Reset the counters of the generators together */
+#define PWM1_ENABLE_REG           ( *((volatile uint32 *)0x40029008) )   /* Output enable of the 8 PWM signals */
+#define PWM1_INVERT_REG           ( *((volatile uint32 *)0x4002900C) )   /* Output inversion of the 8 PWM signals */
+
+/* Registers base address of the generator 0 of PWM Module 1, the generators are 0x40 bytes apart */
+#define PWM1_GEN0_BASE_ADDRESS    ( (volatile uint8 *)0x40029040 )
+#define PWM_GEN_ADDRESS_STEP      ( 0x40 )
+
+/******************************************************************************
+ *                     Generator Register Offsets                             *
+ ******************************************************************************/
+#define PWM_GEN_CTL_REG_OFFSET    ( 0x00 )    /* Generator control (enable and update modes) */
+#define PWM_GEN_LOAD_REG_OFFSET   ( 0x10 )    /* Counter load value (period - 1) */
+#define PWM_GEN_CMPA_REG_OFFSET   ( 0x18 )    /* Comparator A */
+#define PWM_GEN_CMPB_REG_OFFSET   ( 0x1C )    /* Comparator B */
+#define PWM_GEN_GENA_REG_OFFSET   ( 0x20 )    /* Actions of the output A */
+#define PWM_GEN_GENB_REG_OFFSET   ( 0x24 )    /* Actions of the output B */
+
+#endif /* MCAL_PWM_PWM_REGS_H_ */
@@ -75,8 +75,8 @@ const Port_ConfigType Port_PinsConfigurations [NUMBER_OF_PORT_PINS] =
 
      { PORT_F_ID, PORT_F_PIN_0, PORT_PIN_MODE_DIO, PORT_PIN_IN, INTERNAL_RESISTOR_OFF, PORT_PIN_LEVEL_LOW, TRUE, TRUE, TRUE },    /* PF0 (GPIO, locked by default) */
      { PORT_F_ID, PORT_F_PIN_1, PORT_PIN_MODE_DIO, PORT_PIN_OUT, INTERNAL_RESISTOR_OFF, PORT_PIN_LEVEL_LOW, TRUE, TRUE, TRUE },   /* PF1 (GPIO) LED_RED */
-     { PORT_F_ID, PORT_F_PIN_2, PORT_PIN_MODE_DIO, PORT_PIN_IN, INTERNAL_RESISTOR_OFF, PORT_PIN_LEVEL_LOW, TRUE, TRUE, TRUE },    /* PF2 (GPIO) */
-     { PORT_F_ID, PORT_F_PIN_3, PORT_PIN_MODE_DIO, PORT_PIN_IN, INTERNAL_RESISTOR_OFF, PORT_PIN_LEVEL_LOW, TRUE, TRUE, TRUE },    /* PF3 (GPIO) */
+     { PORT_F_ID, PORT_F_PIN_2, PORT_PIN_MODE_DIO, PORT_PIN_OUT, INTERNAL_RESISTOR_OFF, PORT_PIN_LEVEL_LOW, TRUE, TRUE, TRUE },   /* PF2 (GPIO) LED_BLUE */
+     { PORT_F_ID, PORT_F_PIN_3, PORT_PIN_MODE_DIO, PORT_PIN_OUT, INTERNAL_RESISTOR_OFF, PORT_PIN_LEVEL_LOW, TRUE, TRUE, TRUE },   /* PF3 (GPIO) LED_GREEN */
      { PORT_F_ID, PORT_F_PIN_4, PORT_PIN_MODE_DIO, PORT_PIN_IN, INTERNAL_RESISTOR_PULL_UP, PORT_PIN_LEVEL_LOW, TRUE, TRUE, TRUE } /* PF4 (GPIO) SW1 */
 
 };
@@ -0,0 +1,193 @@
+ /******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: Uart.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - UART Driver.
+ *
+ *              Single producer / single consumer ring buffer: Uart_Transmit only moves the
+ *              head and the UART0 interrupt only moves the tail, so neither locks the other.
+ *              Uart_Transmit pends the UART0 interrupt by software to start the transmission,
+ *              the handler fills the hardware FIFO and keeps the TX interrupt enabled only
+ *              while bytes are left, so the interrupt mask is written by the handler only.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Uart.h"
+#include "Uart_Regs.h"
+#include "MCAL/IRQ/Irq.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define UART0_CLOCK_MASK                0x00000001         // UART0 bit mask in RCGCUART and PRUART registers.
+#define UART_FR_TXFF_MASK               0x00000020         // Transmit FIFO full bit mask in FR register.
+#define UART_LCRH_WLEN_8_FEN            0x00000070         // 8 bits word length with the FIFOs enabled in LCRH register.
+#define UART_CTL_UARTEN_TXE             0x00000101         // UART enable and transmit enable bits in CTL register.
+#define UART_IM_TXIM_MASK               0x00000020         // Transmit interrupt bit mask in IM and ICR registers.
+#define UART_ICR_ALL_MASK               0x000017F2         // All the interrupt clear bits in ICR register.
+#define UART_IFLS_TX_HALF               0x00000002         // Transmit interrupt when the FIFO is half empty (8 bytes left).
+#define UART_CC_SYSTEM_CLOCK            0x00000000         // The system clock is the UART clock.
+
+/* Baud rate divisor in 1/64 units rounded to the nearest: UART_CLOCK_HZ / (16 * UART_BAUD_RATE) * 64 */
+#define UART_BAUD_DIVISOR               ((((UART_CLOCK_HZ * 8UL) / UART_BAUD_RATE) + 1UL) / 2UL)
+#define UART_IBRD_VALUE                 (UART_BAUD_DIVISOR >> 6)
+#define UART_FBRD_VALUE                 (UART_BAUD_DIVISOR & 0x3FUL)
+
+#define UART_TX_INDEX_MASK              (UART_TX_BUFFER_SIZE - 1U)
+
+#if (UART_IBRD_VALUE == 0)
+#error "UART_BAUD_RATE is too high for UART_CLOCK_HZ"
+#endif
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+static boolean g_Uart_Initialized = FALSE;
+
+/* The transmit ring buffer, the indexes run freely and are masked on access */
+static uint8 g_Uart_Tx_Buffer[UART_TX_BUFFER_SIZE];
+static volatile uint16 g_Uart_Tx_Head = 0;    /* Written by Uart_Transmit only */
+static volatile uint16 g_Uart_Tx_Tail = 0;    /* Written by the interrupt only */
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Uart0_Handler(void);
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Uart_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to setup UART0 for transmission at UART_BAUD_RATE (8N1 with the FIFO)
+*              and install its interrupt handler, the PA1 pin is configured by the Port Driver.
+************************************************************************************/
+void Uart_Init(void)
+{
+    /* Enable clock for UART0 and wait for clock to start */
+    SYSCTL_RCGCUART_REG |= UART0_CLOCK_MASK;
+    while(!(SYSCTL_PRUART_REG & UART0_CLOCK_MASK));
+
+    /* The UART is disabled while it is configured */
+    UART0_CTL_REG  = 0;
+    UART0_IBRD_REG = UART_IBRD_VALUE;
+    UART0_FBRD_REG = UART_FBRD_VALUE;
+    UART0_LCRH_REG = UART_LCRH_WLEN_8_FEN;   /* Written after the divisors to latch them */
+    UART0_CC_REG   = UART_CC_SYSTEM_CLOCK;
+    UART0_IFLS_REG = UART_IFLS_TX_HALF;
+    UART0_IM_REG   = 0;
+    UART0_ICR_REG  = UART_ICR_ALL_MASK;
+
+    g_Uart_Tx_Head = 0;
+    g_Uart_Tx_Tail = 0;
+
+    (void)Irq_InstallHandler(IRQ_PERIPHERAL_VECTOR(UART0_IRQ_NUMBER), Uart0_Handler);
+    Irq_SetPriority(UART0_IRQ_NUMBER, UART_INTERRUPT_PRIORITY);
+    Irq_EnableInterrupt(UART0_IRQ_NUMBER);
+
+    UART0_CTL_REG = UART_CTL_UARTEN_TXE;
+    g_Uart_Initialized = TRUE;
+}
+
+
+/************************************************************************************
+* Service Name: Uart_Transmit
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Data_Ptr - Bytes to send
+*                  Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the driver is not initialized or the ring
+*                                buffer has no room for all the bytes (nothing is queued)
+* Description: Function to queue bytes for transmission without waiting, it can be called from
+*              the tasks and the ISRs but the callers must not preempt each other (one producer).
+************************************************************************************/
+Std_ReturnType Uart_Transmit(const uint8 * Data_Ptr, uint16 Length)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 head = g_Uart_Tx_Head;
+    uint16 index = 0;
+
+    if((TRUE == g_Uart_Initialized) && (NULL_PTR != Data_Ptr) && (Length <= Uart_GetTxFree()))
+    {
+        for(index = 0; index < Length; index++)
+        {
+            g_Uart_Tx_Buffer[(uint16)(head + index) & UART_TX_INDEX_MASK] = Data_Ptr[index];
+        }
+
+        /* The bytes are in the buffer before the interrupt can see the new head */
+        MEMORY_BARRIER();
+        g_Uart_Tx_Head = (uint16)(head + Length);
+
+        /* Start the handler, it returns at once if the FIFO is already being refilled by the TX interrupt */
+        Irq_SetPending(UART0_IRQ_NUMBER);
+        ret = E_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+
+/************************************************************************************
+* Service Name: Uart_GetTxFree
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Free bytes in the transmit ring buffer
+* Description: Function to return the room left for Uart_Transmit.
+************************************************************************************/
+uint16 Uart_GetTxFree(void)
+{
+    return (uint16)(UART_TX_BUFFER_SIZE - (uint16)(g_Uart_Tx_Head - g_Uart_Tx_Tail));
+}
+
+
+/* UART0 interrupt handler, refill the FIFO from the ring buffer */
+static void Uart0_Handler(void)
+{
+    uint16 tail = g_Uart_Tx_Tail;
+    uint16 head = g_Uart_Tx_Head;
+
+    UART0_ICR_REG = UART_IM_TXIM_MASK;
+
+    while((tail != head) && (0 == (UART0_FR_REG & UART_FR_TXFF_MASK)))
+    {
+        UART0_DR_REG = g_Uart_Tx_Buffer[tail & UART_TX_INDEX_MASK];
+        tail++;
+    }
+    g_Uart_Tx_Tail = tail;
+
+    if(tail != head)
+    {
+        /* The FIFO is full, continue when it is half empty */
+        UART0_IM_REG |= UART_IM_TXIM_MASK;
+    }
+    else
+    {
+        /* The bytes queued after head was read pended the interrupt again */
+        UART0_IM_REG &= ~UART_IM_TXIM_MASK;
+    }
+}
@@ -0,0 +1,84 @@
+ /******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: Uart.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - UART Driver.
+ *              Transmit only on UART0 (PA1), the bytes are queued in a ring buffer
+ *              and sent by the UART0 interrupt so the caller never waits for the line.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef UART_H
+#define UART_H
+
+/*******************************************************************************
+ *                                Inclusions                                   *
+ *******************************************************************************/
+
+#include "Std_Types.h"
+
+/* UART Pre-Compile Configuration Header file */
+#include "Uart_Cfg.h"
+
+#if ((UART_TX_BUFFER_SIZE == 0) || (UART_TX_BUFFER_SIZE > 32768) \
+    || ((UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1)) != 0))
+#error "UART_TX_BUFFER_SIZE must be a power of 2 up to 32768"
+#endif
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* UART0 peripheral interrupt number */
+#define UART0_IRQ_NUMBER                    (5U)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Uart_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to setup UART0 for transmission at UART_BAUD_RATE (8N1 with the FIFO)
+*              and install its interrupt handler, the PA1 pin is configured by the Port Driver.
+************************************************************************************/
+void Uart_Init(void);
+
+
+/************************************************************************************
+* Service Name: Uart_Transmit
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Data_Ptr - Bytes to send
+*                  Length - Number of bytes
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_NOT_OK if the driver is not initialized or the ring
+*                                buffer has no room for all the bytes (nothing is queued)
+* Description: Function to queue bytes for transmission without waiting, it can be called from
+*              the tasks and the ISRs but the callers must not preempt each other (one producer).
+************************************************************************************/
+Std_ReturnType Uart_Transmit(const uint8 * Data_Ptr, uint16 Length);
+
+
+/************************************************************************************
+* Service Name: Uart_GetTxFree
+* Sync/Async: Synchronous
+* Reentrancy: reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint16 - Free bytes in the transmit ring buffer
+* Description: Function to return the room left for Uart_Transmit.
+************************************************************************************/
+uint16 Uart_GetTxFree(void);
+
+#endif /* UART_H */
@@ -0,0 +1,29 @@
+ /******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: Uart_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - UART Driver
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef UART_CFG_H_
+#define UART_CFG_H_
+
+#include "MCAL/MCU/Mcu_Cfg.h"
+
+/* UART clock, the system clock */
+#define UART_CLOCK_HZ                       MCU_SYSTEM_CLOCK_HZ
+
+/* Baud rate of UART0 (8 data bits, no parity, 1 stop bit), up to UART_CLOCK_HZ / 16 */
+#define UART_BAUD_RATE                      (115200UL)
+
+/* Size in bytes of the transmit ring buffer, MUST be a power of 2 (up to 32768) */
+#define UART_TX_BUFFER_SIZE                 (256U)
+
+/* NVIC priority of the UART0 interrupt (0 is the highest, 7 is the lowest) */
+#define UART_INTERRUPT_PRIORITY             (6U)
+
+#endif /* UART_CFG_H_ */
@@ -0,0 +1,37 @@
+ /******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: Uart_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - UART Driver Registers
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef MCAL_UART_UART_REGS_H_
+#define MCAL_UART_UART_REGS_H_
+
+#include "Std_Types.h"
+
+/*****************************************************************************
+                        System Control Registers
+*****************************************************************************/
+#define SYSCTL_RCGCUART_REG       ( *((volatile uint32 *)0x400FE618) )
+#define SYSCTL_PRUART_REG         ( *((volatile uint32 *)0x400FEA18) )
+
+/*****************************************************************************
+                        UART0 Registers
+*****************************************************************************/
+#define UART0_DR_REG              ( *((volatile uint32 *)0x4000C000) )
+#define UART0_FR_REG              ( *((volatile uint32 *)0x4000C018) )
+#define UART0_IBRD_REG            ( *((volatile uint32 *)0x4000C024) )
+#define UART0_FBRD_REG            ( *((volatile uint32 *)0x4000C028) )
+#define UART0_LCRH_REG            ( *((volatile uint32 *)0x4000C02C) )
+#define UART0_CTL_REG             ( *((volatile uint32 *)0x4000C030) )
+#define UART0_IFLS_REG            ( *((volatile uint32 *)0x4000C034) )
+#define UART0_IM_REG              ( *((volatile uint32 *)0x4000C038) )
+#define UART0_ICR_REG             ( *((volatile uint32 *)0x4000C044) )
+#define UART0_CC_REG              ( *((volatile uint32 *)0x4000CFC8) )
+
+#endif /* MCAL_UART_UART_REGS_H_ */
@@ -5,21 +5,426 @@
  * File Name: Det.c
  *
  * Description: Det stores the development errors reported by other modules.
+ *              The last DET_ERROR_BUFFER_SIZE errors are kept in a ring buffer in the RAM
+ *              with an error counter per module, so the errors are kept for diagnostics
+ *              without stopping the ECU.
+ *              Each (module, API, error) has an entry in an open addressing hash table with
+ *              its occurrence count and timestamps, the entry also rate limits the error so
+ *              an error reported from a periodic path does not flood the ring buffer.
  *
  * Author: Bassam Ashraf
  ******************************************************************************/
 
 #include <Services_Layer/Development_Error_Tracer/Det.h>
 
+/* Interrupts lock of the recording, the errors are reported from the tasks and the ISRs */
+#include "Services_Layer/Scheduler/Os.h"
+
+/* DET_ERROR_HOOK streams the errors as trace frames */
+#include "Services_Layer/Trace/Trace_Hooks.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define DET_BUFFER_INDEX_MASK               (DET_ERROR_BUFFER_SIZE - 1U)
+
+#define DET_STATS_INDEX_MASK                (DET_ERROR_STATS_TABLE_SIZE - 1U)
+
+/* The rate limit window in timestamp units (CPU cycles) */
+#define DET_RATE_LIMIT_WINDOW_CYCLES        ((Gpt_TimestampType)DET_RATE_LIMIT_WINDOW_MS * (GPT_CPU_CLOCK_HZ / 1000UL))
+
+/* One 32-bit key of a (module, API, error) */
+#define DET_ERROR_KEY(ModuleId, ApiId, ErrorId) \
+        (((uint32)(ModuleId) << 16) | ((uint32)(ApiId) << 8) | (uint32)(ErrorId))
+
+/* Multiplicative (Fibonacci) hash, the top 8 bits of the product are the best mixed */
+#define DET_ERROR_KEY_HASH(Key)             ((uint8)(((uint32)((Key) * 0x9E3779B1UL)) >> 24) & DET_STATS_INDEX_MASK)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Error counter of one module */
+typedef struct
+{
+    uint16 ModuleId;
+    uint32 Count;
+}Det_ModuleCounterType;
+
+/* Description: Statistics and rate limit state of one (module, API, error), the entry is free if Stats.Count is 0 */
+typedef struct
+{
+    Det_ErrorStatsType Stats;
+    Gpt_TimestampType Window_Start;
+    uint32 Key;
+    uint32 Window_Count;
+}Det_ErrorStatsEntryType;
+
+/*******************************************************************************
+ *                  Special Global variable for "Det.c" only                   *
+ *******************************************************************************/
+
+/* The last reported errors */
+static Det_ErrorRecordType g_Det_Errors[DET_ERROR_BUFFER_SIZE];
+
+/* Number of all the reported errors */
+static uint32 g_Det_Total_Count = 0;
+
+/* Number of the recorded errors, the next error is written at this index modulo the buffer size */
+static uint32 g_Det_Recorded_Count = 0;
+
+/* Number of the reports dropped by the rate limit */
+static uint32 g_Det_Suppressed_Count = 0;
+
+/* Statistics of each reported (module, API, error) */
+static Det_ErrorStatsEntryType g_Det_Error_Stats[DET_ERROR_STATS_TABLE_SIZE];
+
+/* Counters of the modules in the order of their first error, then the counter of the other modules */
+static Det_ModuleCounterType g_Det_Module_Counters[DET_MAX_MODULES];
+static uint8 g_Det_Modules_Count = 0;
+static uint32 g_Det_Other_Modules_Count = 0;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Det_CountModuleError(uint16 ModuleId);
+
+static boolean Det_UpdateErrorStats(uint32 Key, Gpt_TimestampType Timestamp);
+
+static Det_ErrorStatsEntryType * Det_FindErrorStats(uint32 Key);
+
+/*******************************************************************************
+ *                          Function definitions                               *
+ *******************************************************************************/
+
+/* Description: Clear the recorded errors and the counters */
+void Det_Init(void)
+{
+    uint16 index = 0;
+
+    Os_SuspendAllInterrupts();
+    g_Det_Total_Count = 0;
+    g_Det_Recorded_Count = 0;
+    g_Det_Suppressed_Count = 0;
+    g_Det_Modules_Count = 0;
+    g_Det_Other_Modules_Count = 0;
+    for(index = 0; index < DET_ERROR_STATS_TABLE_SIZE; index++)
+    {
+        g_Det_Error_Stats[index].Stats.Count = 0;
+    }
+    Os_ResumeAllInterrupts();
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Count the error for its module and for its (module, API, error) statistics, then record it
+ *              in the ring buffer (the oldest one is overwritten) and call DET_ERROR_HOOK if it passes the
+ *              rate limit. The ECU is stopped only if DET_HALT_ON_ERROR is STD_ON.
+ *              It can be called from the tasks and the ISRs.
+ */
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
                                 uint8 ErrorId )
 {
+    Det_ErrorRecordType * Record_Ptr = NULL_PTR;
+    Gpt_TimestampType timestamp = 0;
+    boolean forward = FALSE;
+
+    Os_SuspendAllInterrupts();
+
+    timestamp = Gpt_GetTimestamp();
+    g_Det_Total_Count++;
+    Det_CountModuleError(ModuleId);
+    forward = Det_UpdateErrorStats(DET_ERROR_KEY(ModuleId, ApiId, ErrorId), timestamp);
+
+    if(TRUE == forward)
+    {
+        Record_Ptr = &g_Det_Errors[g_Det_Recorded_Count & DET_BUFFER_INDEX_MASK];
+        Record_Ptr->Timestamp  = timestamp;
+        Record_Ptr->ModuleId   = ModuleId;
+        Record_Ptr->InstanceId = InstanceId;
+        Record_Ptr->ApiId      = ApiId;
+        Record_Ptr->ErrorId    = ErrorId;
+        g_Det_Recorded_Count++;
+    }
+    else
+    {
+        g_Det_Suppressed_Count++;
+    }
+
+    Os_ResumeAllInterrupts();
+
+    if(TRUE == forward)
+    {
+        DET_ERROR_HOOK(ModuleId, InstanceId, ApiId, ErrorId);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+#if (DET_HALT_ON_ERROR == STD_ON)
+    /* Stop here so the debugger shows the caller, the error is already recorded */
     while(1)
     {
 
     }
+#endif
     return E_OK;
 }
 
+/*********************************************************************************************/
+
+/*
+ * Description: Copy the recorded error of the required age (0 is the last reported one) to Record_Ptr,
+ *              return E_NOT_OK if there is no such error in the ring buffer.
+ */
+Std_ReturnType Det_GetError(uint8 Age, Det_ErrorRecordType * Record_Ptr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL_PTR != Record_Ptr)
+    {
+        Os_SuspendAllInterrupts();
+        if((Age < DET_ERROR_BUFFER_SIZE) && (Age < g_Det_Recorded_Count))
+        {
+            *Record_Ptr = g_Det_Errors[(g_Det_Recorded_Count - 1U - Age) & DET_BUFFER_INDEX_MASK];
+            ret = E_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the errors reported by a module since Det_Init */
+uint32 Det_GetErrorCount(uint16 ModuleId)
+{
+    uint32 count = 0;
+    uint8 index = 0;
+
+    for(index = 0; index < g_Det_Modules_Count; index++)
+    {
+        if(ModuleId == g_Det_Module_Counters[index].ModuleId)
+        {
+            count = g_Det_Module_Counters[index].Count;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return count;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of all the reported errors since Det_Init */
+uint32 Det_GetTotalErrorCount(void)
+{
+    return g_Det_Total_Count;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Copy the statistics of a (module, API, error) to Stats_Ptr, return E_NOT_OK if it was
+ *              never reported or the statistics table was full at its first report.
+ */
+Std_ReturnType Det_GetErrorStats(uint16 ModuleId, uint8 ApiId, uint8 ErrorId, Det_ErrorStatsType * Stats_Ptr)
+{
+    Det_ErrorStatsEntryType * Entry_Ptr = NULL_PTR;
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL_PTR != Stats_Ptr)
+    {
+        Os_SuspendAllInterrupts();
+        Entry_Ptr = Det_FindErrorStats(DET_ERROR_KEY(ModuleId, ApiId, ErrorId));
+        if((NULL_PTR != Entry_Ptr) && (0 != Entry_Ptr->Stats.Count))
+        {
+            *Stats_Ptr = Entry_Ptr->Stats;
+            ret = E_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the reports dropped by the rate limit since Det_Init */
+uint32 Det_GetSuppressedCount(void)
+{
+    return g_Det_Suppressed_Count;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Return the number of the errors recorded in the ring buffer since Det_Init, it is the
+ *              index of the next recorded error so a reader can follow the buffer with Det_GetRecordedError.
+ */
+uint32 Det_GetRecordedCount(void)
+{
+    return g_Det_Recorded_Count;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Copy the recorded error of an absolute index (0 is the first one recorded since Det_Init)
+ *              to Record_Ptr, return E_NOT_OK if it is not recorded yet or it was overwritten.
+ */
+Std_ReturnType Det_GetRecordedError(uint32 Index, Det_ErrorRecordType * Record_Ptr)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(NULL_PTR != Record_Ptr)
+    {
+        Os_SuspendAllInterrupts();
+        /* The unsigned difference is also valid after the counter wraps */
+        if((g_Det_Recorded_Count - Index - 1U) < DET_ERROR_BUFFER_SIZE)
+        {
+            *Record_Ptr = g_Det_Errors[Index & DET_BUFFER_INDEX_MASK];
+            ret = E_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Os_ResumeAllInterrupts();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/* Description: Count the error of a module, called with the interrupts suspended */
+static void Det_CountModuleError(uint16 ModuleId)
+{
+    uint8 index = 0;
+
+    /* Few modules report errors, a linear search of the small table is enough */
+    while((index < g_Det_Modules_Count) && (ModuleId != g_Det_Module_Counters[index].ModuleId))
+    {
+        index++;
+    }
+    if(index < g_Det_Modules_Count)
+    {
+        g_Det_Module_Counters[index].Count++;
+    }
+    else if(g_Det_Modules_Count < DET_MAX_MODULES)
+    {
+        /* First error of this module */
+        g_Det_Module_Counters[index].ModuleId = ModuleId;
+        g_Det_Module_Counters[index].Count    = 1;
+        g_Det_Modules_Count++;
+    }
+    else
+    {
+        g_Det_Other_Modules_Count++;
+    }
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Update the statistics of the error and return TRUE if it passes the rate limit,
+ *              called with the interrupts suspended. An error without a free entry is never limited.
+ */
+static boolean Det_UpdateErrorStats(uint32 Key, Gpt_TimestampType Timestamp)
+{
+    Det_ErrorStatsEntryType * Entry_Ptr = Det_FindErrorStats(Key);
+    boolean forward = TRUE;
+
+    if(NULL_PTR == Entry_Ptr)
+    {
+        /* The table is full, the error is still counted for its module and recorded */
+    }
+    else if(0 == Entry_Ptr->Stats.Count)
+    {
+        /* First occurrence, take the free entry */
+        Entry_Ptr->Key                   = Key;
+        Entry_Ptr->Stats.Count           = 1;
+        Entry_Ptr->Stats.First_Timestamp = Timestamp;
+        Entry_Ptr->Stats.Last_Timestamp  = Timestamp;
+        Entry_Ptr->Window_Start          = Timestamp;
+        Entry_Ptr->Window_Count          = 1;
+    }
+    else
+    {
+        /* Repeat, a new window starts when the current one is over */
+        Entry_Ptr->Stats.Count++;
+        Entry_Ptr->Stats.Last_Timestamp = Timestamp;
+        if((Timestamp - Entry_Ptr->Window_Start) >= DET_RATE_LIMIT_WINDOW_CYCLES)
+        {
+            Entry_Ptr->Window_Start = Timestamp;
+            Entry_Ptr->Window_Count = 0;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        if(Entry_Ptr->Window_Count < DET_RATE_LIMIT_REPORTS)
+        {
+            Entry_Ptr->Window_Count++;
+        }
+        else
+        {
+            forward = FALSE;
+        }
+    }
+    return forward;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Return the entry of the key, or the free entry to use for it, or NULL_PTR if the table is full.
+ *              Linear probing from the hash slot, the entries are never removed so a free entry ends the search.
+ */
+static Det_ErrorStatsEntryType * Det_FindErrorStats(uint32 Key)
+{
+    Det_ErrorStatsEntryType * Entry_Ptr = NULL_PTR;
+    uint8 slot = DET_ERROR_KEY_HASH(Key);
+    uint16 probes = 0;
+
+    while((NULL_PTR == Entry_Ptr) && (probes < DET_ERROR_STATS_TABLE_SIZE))
+    {
+        if((0 == g_Det_Error_Stats[slot].Stats.Count) || (Key == g_Det_Error_Stats[slot].Key))
+        {
+            Entry_Ptr = &g_Det_Error_Stats[slot];
+        }
+        else
+        {
+            slot = (uint8)((slot + 1U) & DET_STATS_INDEX_MASK);
+            probes++;
+        }
+    }
+    return Entry_Ptr;
+}
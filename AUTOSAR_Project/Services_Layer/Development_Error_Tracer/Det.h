@@ -46,12 +46,92 @@
 #error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+/* Det Pre-Compile Configuration Header file */
+#include "Det_Cfg.h"
+
+/* The timestamp of the recorded errors */
+#include "MCAL/GPT/Gpt.h"
+
+#if ((DET_ERROR_BUFFER_SIZE == 0) || ((DET_ERROR_BUFFER_SIZE & (DET_ERROR_BUFFER_SIZE - 1)) != 0))
+#error "DET_ERROR_BUFFER_SIZE must be a power of 2"
+#endif
+
+#if ((DET_ERROR_STATS_TABLE_SIZE == 0) || (DET_ERROR_STATS_TABLE_SIZE > 256) \
+    || ((DET_ERROR_STATS_TABLE_SIZE & (DET_ERROR_STATS_TABLE_SIZE - 1)) != 0))
+#error "DET_ERROR_STATS_TABLE_SIZE must be a power of 2 up to 256"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: One reported error, the timestamp is read by Gpt_GetTimestamp */
+typedef struct
+{
+    Gpt_TimestampType Timestamp;
+    uint16 ModuleId;
+    uint8 InstanceId;
+    uint8 ApiId;
+    uint8 ErrorId;
+}Det_ErrorRecordType;
+
+/* Description: Occurrences of one (module, API, error) since Det_Init, including the rate limited ones */
+typedef struct
+{
+    uint32 Count;
+    Gpt_TimestampType First_Timestamp;
+    Gpt_TimestampType Last_Timestamp;
+}Det_ErrorStatsType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
+
+/* Description: Clear the recorded errors and the counters */
+void Det_Init(void);
+
+/*
+ * Description: Count the error for its module and for its (module, API, error) statistics, then record it
+ *              in the ring buffer (the oldest one is overwritten) and call DET_ERROR_HOOK if it passes the
+ *              rate limit. The ECU is stopped only if DET_HALT_ON_ERROR is STD_ON.
+ *              It can be called from the tasks and the ISRs.
+ */
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
                                 uint8 ErrorId );
 
+/*
+ * Description: Copy the recorded error of the required age (0 is the last reported one) to Record_Ptr,
+ *              return E_NOT_OK if there is no such error in the ring buffer.
+ */
+Std_ReturnType Det_GetError(uint8 Age, Det_ErrorRecordType * Record_Ptr);
+
+/* Description: Return the number of the errors reported by a module since Det_Init */
+uint32 Det_GetErrorCount(uint16 ModuleId);
+
+/* Description: Return the number of all the reported errors since Det_Init */
+uint32 Det_GetTotalErrorCount(void);
+
+/*
+ * Description: Copy the statistics of a (module, API, error) to Stats_Ptr, return E_NOT_OK if it was
+ *              never reported or the statistics table was full at its first report.
+ */
+Std_ReturnType Det_GetErrorStats(uint16 ModuleId, uint8 ApiId, uint8 ErrorId, Det_ErrorStatsType * Stats_Ptr);
+
+/* Description: Return the number of the reports dropped by the rate limit since Det_Init */
+uint32 Det_GetSuppressedCount(void);
+
+/*
+ * Description: Return the number of the errors recorded in the ring buffer since Det_Init, it is the
+ *              index of the next recorded error so a reader can follow the buffer with Det_GetRecordedError.
+ */
+uint32 Det_GetRecordedCount(void);
+
+/*
+ * Description: Copy the recorded error of an absolute index (0 is the first one recorded since Det_Init)
+ *              to Record_Ptr, return E_NOT_OK if it is not recorded yet or it was overwritten.
+ */
+Std_ReturnType Det_GetRecordedError(uint32 Index, Det_ErrorRecordType * Record_Ptr);
+
 #endif /* DET_H */
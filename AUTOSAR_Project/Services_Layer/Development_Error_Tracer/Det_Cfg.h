@@ -0,0 +1,37 @@
+ /******************************************************************************
+ *
+ * Module: DET
+ *
+ * File Name: Det_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Development Error Tracer.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef DET_CFG_H_
+#define DET_CFG_H_
+
+/* Pre-compile option to stop the ECU in Det_ReportError (debug builds), the error is recorded first */
+#define DET_HALT_ON_ERROR                   (STD_OFF)
+
+/* Number of the last reported errors kept in the ring buffer, MUST be a power of 2 */
+#define DET_ERROR_BUFFER_SIZE               (16U)
+
+/* Number of the modules with their own error counter, the errors of the other modules are counted together */
+#define DET_MAX_MODULES                     (8U)
+
+/*
+ * Number of the entries of the error statistics hash table, one entry per (module, API, error)
+ * with its occurrence count and first/last timestamps, MUST be a power of 2 (up to 256).
+ */
+#define DET_ERROR_STATS_TABLE_SIZE          (16U)
+
+/*
+ * Rate limit of the same (module, API, error): only the first DET_RATE_LIMIT_REPORTS reports in each
+ * window are recorded in the ring buffer and forwarded to DET_ERROR_HOOK (Trace_Hooks.h), the others are only counted.
+ */
+#define DET_RATE_LIMIT_REPORTS              (4U)
+#define DET_RATE_LIMIT_WINDOW_MS            (1000U)
+
+#endif /* DET_CFG_H_ */
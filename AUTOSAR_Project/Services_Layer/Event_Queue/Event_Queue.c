@@ -0,0 +1,162 @@
+ /******************************************************************************
+ *
+ * Module: Event Queue
+ *
+ * File Name: Event_Queue.c
+ *
+ * Description: Source file for the Event Queue Service.
+ *
+ *              Each queue has one producer and one consumer, the write index is only written
+ *              by the producer and the read index is only written by the consumer, so no
+ *              interrupt has to be disabled. The indexes are free running 32-bit counters and
+ *              the slot is the index modulo EVENT_QUEUE_SIZE.
+ *              The memory barriers make the event data visible before the index that publishes it:
+ *              - Push: write the slot -> barrier -> write the write index.
+ *              - Pop : read the write index -> barrier -> read the slot -> barrier -> write the read index.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "Event_Queue.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define EVENT_QUEUE_INDEX_MASK              (EVENT_QUEUE_SIZE - 1U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Structure of one queue, the indexes are written by different contexts */
+typedef struct
+{
+    EventQueue_EventType Events[EVENT_QUEUE_SIZE];
+    volatile uint32 Write_Index;
+    volatile uint32 Read_Index;
+    uint32 Overflow_Count;
+}EventQueue_QueueType;
+
+/*******************************************************************************
+ *                  Special Global variable for "Event_Queue.c" only           *
+ *******************************************************************************/
+
+static EventQueue_QueueType g_Event_Queues[EVENT_QUEUE_NUMBER_OF_QUEUES];
+
+/*******************************************************************************
+ *                          Function definitions                               *
+ *******************************************************************************/
+
+/*
+ * Description: Add an event to the queue, called only by the producer of the queue (one ISR or task).
+ *              Return E_NOT_OK if the queue is full, the event is dropped and counted as an overflow.
+ */
+Std_ReturnType EventQueue_Push(EventQueue_IdType QueueId, const EventQueue_EventType * EventPtr)
+{
+    EventQueue_QueueType * Queue_Ptr = NULL_PTR;
+    uint32 write_index = 0;
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((QueueId < EVENT_QUEUE_NUMBER_OF_QUEUES) && (NULL_PTR != EventPtr))
+    {
+        Queue_Ptr = &g_Event_Queues[QueueId];
+        write_index = Queue_Ptr->Write_Index;
+
+        /* The unsigned subtraction gives the number of the waiting events even if the indexes wrapped around */
+        if((write_index - Queue_Ptr->Read_Index) < EVENT_QUEUE_SIZE)
+        {
+            Queue_Ptr->Events[write_index & EVENT_QUEUE_INDEX_MASK] = *EventPtr;
+
+            /* The event must be complete before the consumer sees the new write index */
+            MEMORY_BARRIER();
+            Queue_Ptr->Write_Index = write_index + 1;
+            ret = E_OK;
+        }
+        else
+        {
+            Queue_Ptr->Overflow_Count++;
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Remove the oldest event from the queue, called only by the consumer of the queue (one task).
+ *              Return E_NOT_OK if the queue is empty.
+ */
+Std_ReturnType EventQueue_Pop(EventQueue_IdType QueueId, EventQueue_EventType * EventPtr)
+{
+    EventQueue_QueueType * Queue_Ptr = NULL_PTR;
+    uint32 read_index = 0;
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((QueueId < EVENT_QUEUE_NUMBER_OF_QUEUES) && (NULL_PTR != EventPtr))
+    {
+        Queue_Ptr = &g_Event_Queues[QueueId];
+        read_index = Queue_Ptr->Read_Index;
+
+        if(read_index != Queue_Ptr->Write_Index)
+        {
+            /* The event is read only after the write index that published it */
+            MEMORY_BARRIER();
+            *EventPtr = Queue_Ptr->Events[read_index & EVENT_QUEUE_INDEX_MASK];
+
+            /* The slot must be read before the producer can reuse it */
+            MEMORY_BARRIER();
+            Queue_Ptr->Read_Index = read_index + 1;
+            ret = E_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the events waiting in the queue */
+uint32 EventQueue_GetCount(EventQueue_IdType QueueId)
+{
+    uint32 count = 0;
+
+    if(QueueId < EVENT_QUEUE_NUMBER_OF_QUEUES)
+    {
+        count = g_Event_Queues[QueueId].Write_Index - g_Event_Queues[QueueId].Read_Index;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return count;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the events dropped because the queue was full */
+uint32 EventQueue_GetOverflowCount(EventQueue_IdType QueueId)
+{
+    uint32 count = 0;
+
+    if(QueueId < EVENT_QUEUE_NUMBER_OF_QUEUES)
+    {
+        count = g_Event_Queues[QueueId].Overflow_Count;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return count;
+}
@@ -0,0 +1,66 @@
+ /******************************************************************************
+ *
+ * Module: Event Queue
+ *
+ * File Name: Event_Queue.h
+ *
+ * Description: Header file for the Event Queue Service, lock-free single producer single
+ *              consumer ring buffers used to pass events from the interrupts to the tasks.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef EVENT_QUEUE_H_
+#define EVENT_QUEUE_H_
+
+#include "Std_Types.h"
+
+/* Event Queue Pre-Compile Configuration Header file */
+#include "Event_Queue_Cfg.h"
+
+#if ((EVENT_QUEUE_SIZE == 0) || ((EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) != 0))
+#error "EVENT_QUEUE_SIZE must be a power of 2"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for EventQueue_IdType used by the Event Queue APIs (index of the queue) */
+typedef uint8 EventQueue_IdType;
+
+/* Description: Structure of one event:
+ *  1. The event ID defined by the producer (edge, timer expiry, capture ...).
+ *  2. A small parameter of the event (channel, timer ID ...).
+ *  3. The event data (level, captured value, time stamp ...).
+ */
+typedef struct
+{
+    uint16 Event_Id;
+    uint16 Param;
+    uint32 Data;
+}EventQueue_EventType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/*
+ * Description: Add an event to the queue, called only by the producer of the queue (one ISR or task).
+ *              Return E_NOT_OK if the queue is full, the event is dropped and counted as an overflow.
+ */
+Std_ReturnType EventQueue_Push(EventQueue_IdType QueueId, const EventQueue_EventType * EventPtr);
+
+/*
+ * Description: Remove the oldest event from the queue, called only by the consumer of the queue (one task).
+ *              Return E_NOT_OK if the queue is empty.
+ */
+Std_ReturnType EventQueue_Pop(EventQueue_IdType QueueId, EventQueue_EventType * EventPtr);
+
+/* Description: Return the number of the events waiting in the queue */
+uint32 EventQueue_GetCount(EventQueue_IdType QueueId);
+
+/* Description: Return the number of the events dropped because the queue was full */
+uint32 EventQueue_GetOverflowCount(EventQueue_IdType QueueId);
+
+#endif /* EVENT_QUEUE_H_ */
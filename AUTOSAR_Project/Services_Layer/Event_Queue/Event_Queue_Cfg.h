@@ -0,0 +1,24 @@
+ /******************************************************************************
+ *
+ * Module: Event Queue
+ *
+ * File Name: Event_Queue_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Event Queue Service.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef EVENT_QUEUE_CFG_H_
+#define EVENT_QUEUE_CFG_H_
+
+/* Number of the event queues, each queue has one producer (ISR) and one consumer (task) */
+#define EVENT_QUEUE_NUMBER_OF_QUEUES        (1U)
+
+/* Number of the events in each queue, MUST be a power of 2 */
+#define EVENT_QUEUE_SIZE                    (16U)
+
+/* Queue Index used by the producers and the consumers */
+#define EventQueueConf_BUTTON_EVENTS_QUEUE_ID (uint8)0x00
+
+#endif /* EVENT_QUEUE_CFG_H_ */
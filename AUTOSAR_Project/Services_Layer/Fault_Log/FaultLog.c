@@ -0,0 +1,403 @@
+ /******************************************************************************
+ *
+ * Module: Fault Log
+ *
+ * File Name: FaultLog.c
+ *
+ * Description: Source file for the Fault Log Service.
+ *
+ *              Write-back cache: the Det ring buffer is the RAM cache, Det_ReportError never
+ *              touches the EEPROM. The background task takes the new errors into a block buffer
+ *              and writes the whole block when it holds FAULTLOG_RECORDS_PER_BLOCK errors, the
+ *              oldest one waited FAULTLOG_FLUSH_DELAY_MS or FaultLog_Flush is called, so the
+ *              EEPROM sees one block write for several errors instead of one write per error.
+ *
+ *              Block layout (16 words):
+ *                Words 0 - 14 : up to 5 errors of 3 words each, in the order of their report
+ *                               [0] ModuleId | ApiId << 16 | ErrorId << 24
+ *                               [1] Timestamp bits 0 - 31
+ *                               [2] Timestamp bits 32 - 55 | InstanceId << 24
+ *                Word 15      : header, Sequence << 8 | number of errors
+ *              A block write is two EEPROM jobs: the old header of the block is erased first, then
+ *              the block is written with its header as the last word. A block interrupted by a reset
+ *              has an erased header, so it is not taken as part of the log with the old header and
+ *              a mix of old and new errors. The blocks are written round-robin with an incremented
+ *              24-bit sequence, so the newest block is the one not followed by the next sequence and
+ *              every word of the log area is written once per FAULTLOG_NUMBER_OF_BLOCKS block writes
+ *              (wear leveling), the header words twice.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "FaultLog.h"
+
+/* The Os tick for the flush delay */
+#include "Services_Layer/Scheduler/Os.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define FAULTLOG_WORDS_PER_RECORD           (3U)
+#define FAULTLOG_HEADER_WORD                (EEP_WORDS_PER_BLOCK - 1U)
+
+#define FAULTLOG_SEQUENCE_MASK              (0x00FFFFFFUL)
+
+#define FAULTLOG_HEADER(Sequence, Count)    (((uint32)(Sequence) << 8) | (uint32)(Count))
+#define FAULTLOG_HEADER_SEQUENCE(Header)    ((Header) >> 8)
+#define FAULTLOG_HEADER_COUNT(Header)       ((uint8)((Header) & 0xFFU))
+
+/* An erased header has a count of 0xFF so it is never valid */
+#define FAULTLOG_HEADER_IS_VALID(Header)    ((FAULTLOG_HEADER_COUNT(Header) != 0U) && \
+                                             (FAULTLOG_HEADER_COUNT(Header) <= FAULTLOG_RECORDS_PER_BLOCK))
+
+/* The flush delay in Os ticks */
+#define FAULTLOG_FLUSH_DELAY_TICKS          ((FAULTLOG_FLUSH_DELAY_MS + OS_BASE_TIME - 1U) / OS_BASE_TIME)
+
+#if ((FAULTLOG_RECORDS_PER_BLOCK * FAULTLOG_WORDS_PER_RECORD) > FAULTLOG_HEADER_WORD)
+#error "The Fault Log records do not fit in an EEPROM block"
+#endif
+
+/*******************************************************************************
+ *                  Special Global variable for "FaultLog.c" only              *
+ *******************************************************************************/
+
+/* The block being filled or written, it is not changed while the EEPROM write job runs */
+static uint32 g_FaultLog_Block_Buffer[EEP_WORDS_PER_BLOCK];
+static uint8 g_FaultLog_Pending_Count = 0;
+static boolean g_FaultLog_Writing = FALSE;
+
+/* TRUE while the write job erases the old header of the block, the block itself is written after it */
+static boolean g_FaultLog_Erasing_Header = FALSE;
+static const uint32 g_FaultLog_Erased_Header = EEP_ERASED_WORD;
+
+/* Os tick at which the first error of the block buffer was taken */
+static uint32 g_FaultLog_Pending_Tick = 0;
+
+/* Set by FaultLog_Flush, it can be called from any task */
+static volatile boolean g_FaultLog_Flush_Request = FALSE;
+
+/* Block (relative to FAULTLOG_FIRST_BLOCK) and sequence of the next block write */
+static uint8 g_FaultLog_Next_Block = 0;
+static uint32 g_FaultLog_Next_Sequence = 0;
+
+/* TRUE if the block before g_FaultLog_Next_Block holds the newest stored errors */
+static boolean g_FaultLog_Has_Stored = FALSE;
+
+/* Absolute Det record index of the next error to take and the number of the errors lost before they were taken */
+static uint32 g_FaultLog_Read_Index = 0;
+static uint32 g_FaultLog_Lost_Count = 0;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void FaultLog_TakeErrors(void);
+
+static void FaultLog_StartWrite(void);
+
+/*******************************************************************************
+ *                          Function definitions                               *
+ *******************************************************************************/
+
+/*
+ * Description: Find the newest block of the log in the EEPROM and start taking the errors recorded
+ *              by the Det from now on, it must be called after Det_Init and Eep_Init.
+ */
+void FaultLog_Init(void)
+{
+    uint32 headers[FAULTLOG_NUMBER_OF_BLOCKS];
+    uint32 header = 0;
+    uint32 next_header = 0;
+    uint8 block = 0;
+
+    g_FaultLog_Pending_Count  = 0;
+    g_FaultLog_Writing        = FALSE;
+    g_FaultLog_Erasing_Header = FALSE;
+    g_FaultLog_Flush_Request  = FALSE;
+    g_FaultLog_Next_Block     = 0;
+    g_FaultLog_Next_Sequence  = 0;
+    g_FaultLog_Has_Stored     = FALSE;
+    g_FaultLog_Lost_Count     = 0;
+    g_FaultLog_Read_Index     = Det_GetRecordedCount();
+
+    for(block = 0; block < FAULTLOG_NUMBER_OF_BLOCKS; block++)
+    {
+        if(E_OK == Eep_Read(FAULTLOG_FIRST_BLOCK + block, g_FaultLog_Block_Buffer, EEP_WORDS_PER_BLOCK))
+        {
+            headers[block] = g_FaultLog_Block_Buffer[FAULTLOG_HEADER_WORD];
+        }
+        else
+        {
+            headers[block] = EEP_ERASED_WORD;
+        }
+    }
+
+    /* A consistent log has one valid block not followed by the next sequence, the first one found is used */
+    block = 0;
+    while((FALSE == g_FaultLog_Has_Stored) && (block < FAULTLOG_NUMBER_OF_BLOCKS))
+    {
+        header      = headers[block];
+        next_header = headers[(block + 1U) % FAULTLOG_NUMBER_OF_BLOCKS];
+        if(FAULTLOG_HEADER_IS_VALID(header)
+            && ((!FAULTLOG_HEADER_IS_VALID(next_header))
+                || (FAULTLOG_HEADER_SEQUENCE(next_header) != ((FAULTLOG_HEADER_SEQUENCE(header) + 1U) & FAULTLOG_SEQUENCE_MASK))))
+        {
+            g_FaultLog_Next_Block    = (uint8)((block + 1U) % FAULTLOG_NUMBER_OF_BLOCKS);
+            g_FaultLog_Next_Sequence = (FAULTLOG_HEADER_SEQUENCE(header) + 1U) & FAULTLOG_SEQUENCE_MASK;
+            g_FaultLog_Has_Stored    = TRUE;
+        }
+        else
+        {
+            block++;
+        }
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Request writing the pending errors without waiting for the flush delay (before a planned reset) */
+void FaultLog_Flush(void)
+{
+    g_FaultLog_Flush_Request = TRUE;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Copy the stored error of the required age (0 is the last one written to the EEPROM) to Record_Ptr,
+ *              return E_NOT_OK if there is no such error or the EEPROM is busy with a write.
+ */
+Std_ReturnType FaultLog_GetRecord(uint16 Age, Det_ErrorRecordType * Record_Ptr)
+{
+    uint32 block_words[EEP_WORDS_PER_BLOCK];
+    const uint32 * Word_Ptr = NULL_PTR;
+    uint32 sequence = (g_FaultLog_Next_Sequence - 1U) & FAULTLOG_SEQUENCE_MASK;
+    uint8 block = g_FaultLog_Next_Block;
+    uint8 blocks_read = 0;
+    uint8 count = 0;
+    boolean done = FALSE;
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL_PTR == Record_Ptr) || (FALSE == g_FaultLog_Has_Stored))
+    {
+        done = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    /* Walk back from the newest block while the sequence is continuous */
+    while((FALSE == done) && (blocks_read < FAULTLOG_NUMBER_OF_BLOCKS))
+    {
+        block = (uint8)((block + FAULTLOG_NUMBER_OF_BLOCKS - 1U) % FAULTLOG_NUMBER_OF_BLOCKS);
+        blocks_read++;
+
+        if((E_OK != Eep_Read(FAULTLOG_FIRST_BLOCK + block, block_words, EEP_WORDS_PER_BLOCK))
+            || (!FAULTLOG_HEADER_IS_VALID(block_words[FAULTLOG_HEADER_WORD]))
+            || (FAULTLOG_HEADER_SEQUENCE(block_words[FAULTLOG_HEADER_WORD]) != sequence))
+        {
+            done = TRUE;
+        }
+        else
+        {
+            count = FAULTLOG_HEADER_COUNT(block_words[FAULTLOG_HEADER_WORD]);
+            if(Age < count)
+            {
+                /* The newest error of a block is its last one */
+                Word_Ptr = &block_words[(count - 1U - Age) * FAULTLOG_WORDS_PER_RECORD];
+                Record_Ptr->ModuleId   = (uint16)(Word_Ptr[0] & 0xFFFFU);
+                Record_Ptr->ApiId      = (uint8)((Word_Ptr[0] >> 16) & 0xFFU);
+                Record_Ptr->ErrorId    = (uint8)(Word_Ptr[0] >> 24);
+                Record_Ptr->Timestamp  = ((Gpt_TimestampType)(Word_Ptr[2] & 0x00FFFFFFUL) << 32) | Word_Ptr[1];
+                Record_Ptr->InstanceId = (uint8)(Word_Ptr[2] >> 24);
+                ret  = E_OK;
+                done = TRUE;
+            }
+            else
+            {
+                Age -= count;
+                sequence = (sequence - 1U) & FAULTLOG_SEQUENCE_MASK;
+            }
+        }
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the errors overwritten in the Det ring buffer before they were taken by the log */
+uint32 FaultLog_GetLostCount(void)
+{
+    return g_FaultLog_Lost_Count;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Os background task, it drives the EEPROM write job, takes the new errors from the Det
+ *              and starts writing a block when it is full, the flush delay is over or a flush is requested.
+ */
+void FaultLog_MainFunction(void)
+{
+    Eep_StatusType status = EEP_IDLE;
+
+    Eep_MainFunction();
+
+    if(TRUE == g_FaultLog_Writing)
+    {
+        status = Eep_GetStatus();
+        if((EEP_IDLE == status) && (TRUE == g_FaultLog_Erasing_Header))
+        {
+            /* The old header is erased, write the block */
+            g_FaultLog_Writing = FALSE;
+            FaultLog_StartWrite();
+        }
+        else if(EEP_IDLE == status)
+        {
+            /* The block is stored, the next write goes to the next block */
+            g_FaultLog_Writing       = FALSE;
+            g_FaultLog_Has_Stored    = TRUE;
+            g_FaultLog_Pending_Count = 0;
+            g_FaultLog_Next_Block    = (uint8)((g_FaultLog_Next_Block + 1U) % FAULTLOG_NUMBER_OF_BLOCKS);
+            g_FaultLog_Next_Sequence = (g_FaultLog_Next_Sequence + 1U) & FAULTLOG_SEQUENCE_MASK;
+        }
+        else if(EEP_FAILED == status)
+        {
+            /* Write the block again, its header was not written yet */
+            g_FaultLog_Writing = FALSE;
+            FaultLog_StartWrite();
+        }
+        else
+        {
+            /* The write job is running */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    if(FALSE == g_FaultLog_Writing)
+    {
+        FaultLog_TakeErrors();
+        if(0 == g_FaultLog_Pending_Count)
+        {
+            g_FaultLog_Flush_Request = FALSE;
+        }
+        else if((FAULTLOG_RECORDS_PER_BLOCK == g_FaultLog_Pending_Count) || (TRUE == g_FaultLog_Flush_Request)
+                || ((Os_GetTickCount() - g_FaultLog_Pending_Tick) >= FAULTLOG_FLUSH_DELAY_TICKS))
+        {
+            FaultLog_StartWrite();
+        }
+        else
+        {
+            /* Wait for more errors */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Move the new errors of the Det ring buffer to the block buffer until it is full */
+static void FaultLog_TakeErrors(void)
+{
+    Det_ErrorRecordType record;
+    uint32 * Word_Ptr = NULL_PTR;
+    uint32 recorded_count = Det_GetRecordedCount();
+
+    /* Skip directly to the oldest error still in the ring buffer */
+    if((recorded_count - g_FaultLog_Read_Index) > DET_ERROR_BUFFER_SIZE)
+    {
+        g_FaultLog_Lost_Count += recorded_count - DET_ERROR_BUFFER_SIZE - g_FaultLog_Read_Index;
+        g_FaultLog_Read_Index  = recorded_count - DET_ERROR_BUFFER_SIZE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    while((g_FaultLog_Pending_Count < FAULTLOG_RECORDS_PER_BLOCK) && (g_FaultLog_Read_Index != recorded_count))
+    {
+        if(E_OK == Det_GetRecordedError(g_FaultLog_Read_Index, &record))
+        {
+            if(0 == g_FaultLog_Pending_Count)
+            {
+                g_FaultLog_Pending_Tick = Os_GetTickCount();
+            }
+            else
+            {
+                /* No Action Required */
+            }
+            Word_Ptr = &g_FaultLog_Block_Buffer[g_FaultLog_Pending_Count * FAULTLOG_WORDS_PER_RECORD];
+            Word_Ptr[0] = (uint32)record.ModuleId | ((uint32)record.ApiId << 16) | ((uint32)record.ErrorId << 24);
+            Word_Ptr[1] = (uint32)record.Timestamp;
+            Word_Ptr[2] = ((uint32)(record.Timestamp >> 32) & 0x00FFFFFFUL) | ((uint32)record.InstanceId << 24);
+            g_FaultLog_Pending_Count++;
+        }
+        else
+        {
+            /* Overwritten by new reports since the count was read */
+            g_FaultLog_Lost_Count++;
+        }
+        g_FaultLog_Read_Index++;
+    }
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Complete the block buffer with its header and start the EEPROM write job, or the job
+ *              erasing the old header first when the block is not erased
+ */
+static void FaultLog_StartWrite(void)
+{
+    uint32 block_words[EEP_WORDS_PER_BLOCK];
+    uint8 block = (uint8)(FAULTLOG_FIRST_BLOCK + g_FaultLog_Next_Block);
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 word = 0;
+
+    for(word = (uint8)(g_FaultLog_Pending_Count * FAULTLOG_WORDS_PER_RECORD); word < FAULTLOG_HEADER_WORD; word++)
+    {
+        g_FaultLog_Block_Buffer[word] = EEP_ERASED_WORD;
+    }
+    g_FaultLog_Block_Buffer[FAULTLOG_HEADER_WORD] = FAULTLOG_HEADER(g_FaultLog_Next_Sequence, g_FaultLog_Pending_Count);
+
+    if(E_OK != Eep_Read(block, block_words, EEP_WORDS_PER_BLOCK))
+    {
+        /* The EEPROM is not ready, tried again on the next run */
+    }
+    else if(EEP_ERASED_WORD != block_words[FAULTLOG_HEADER_WORD])
+    {
+        g_FaultLog_Erasing_Header = TRUE;
+        ret = Eep_Write(block, FAULTLOG_HEADER_WORD, &g_FaultLog_Erased_Header, 1U);
+    }
+    else
+    {
+        g_FaultLog_Erasing_Header = FALSE;
+        ret = Eep_Write(block, 0U, g_FaultLog_Block_Buffer, EEP_WORDS_PER_BLOCK);
+    }
+
+    if(E_OK == ret)
+    {
+        g_FaultLog_Writing = TRUE;
+        if(g_FaultLog_Read_Index == Det_GetRecordedCount())
+        {
+            /* All the errors reported before the flush request are in this block */
+            g_FaultLog_Flush_Request = FALSE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    else
+    {
+        /* The EEPROM is not ready, tried again on the next run */
+    }
+}
@@ -0,0 +1,64 @@
+ /******************************************************************************
+ *
+ * Module: Fault Log
+ *
+ * File Name: FaultLog.h
+ *
+ * Description: Header file for the Fault Log Service, it keeps the errors recorded by the Det
+ *              across resets by writing them back to the on-chip EEPROM from a background task.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef FAULTLOG_H_
+#define FAULTLOG_H_
+
+#include "Std_Types.h"
+
+/* Fault Log Pre-Compile Configuration Header file */
+#include "FaultLog_Cfg.h"
+
+/* The recorded errors type and the EEPROM geometry */
+#include "Services_Layer/Development_Error_Tracer/Det.h"
+#include "MCAL/EEP/Eep.h"
+
+#if ((FAULTLOG_NUMBER_OF_BLOCKS < 2) || ((FAULTLOG_FIRST_BLOCK + FAULTLOG_NUMBER_OF_BLOCKS) > EEP_NUMBER_OF_BLOCKS))
+#error "The Fault Log needs at least 2 blocks inside the EEPROM"
+#endif
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Number of the errors stored in one EEPROM block (3 words each, the last word is the block header) */
+#define FAULTLOG_RECORDS_PER_BLOCK          (5U)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/*
+ * Description: Find the newest block of the log in the EEPROM and start taking the errors recorded
+ *              by the Det from now on, it must be called after Det_Init and Eep_Init.
+ */
+void FaultLog_Init(void);
+
+/* Description: Request writing the pending errors without waiting for the flush delay (before a planned reset) */
+void FaultLog_Flush(void);
+
+/*
+ * Description: Copy the stored error of the required age (0 is the last one written to the EEPROM) to Record_Ptr,
+ *              return E_NOT_OK if there is no such error or the EEPROM is busy with a write.
+ */
+Std_ReturnType FaultLog_GetRecord(uint16 Age, Det_ErrorRecordType * Record_Ptr);
+
+/* Description: Return the number of the errors overwritten in the Det ring buffer before they were taken by the log */
+uint32 FaultLog_GetLostCount(void);
+
+/*
+ * Description: Os background task, it drives the EEPROM write job, takes the new errors from the Det
+ *              and starts writing a block when it is full, the flush delay is over or a flush is requested.
+ */
+void FaultLog_MainFunction(void);
+
+#endif /* FAULTLOG_H_ */
@@ -0,0 +1,25 @@
+ /******************************************************************************
+ *
+ * Module: Fault Log
+ *
+ * File Name: FaultLog_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Fault Log Service.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef FAULTLOG_CFG_H_
+#define FAULTLOG_CFG_H_
+
+/* The EEPROM blocks used by the log, the blocks are written round-robin to spread the wear (at least 2) */
+#define FAULTLOG_FIRST_BLOCK                (0U)
+#define FAULTLOG_NUMBER_OF_BLOCKS           (32U)
+
+/*
+ * Maximum time in ms a recorded error waits in the RAM before it is written to the EEPROM,
+ * a block is written earlier when it is full (FAULTLOG_RECORDS_PER_BLOCK errors).
+ */
+#define FAULTLOG_FLUSH_DELAY_MS             (5000U)
+
+#endif /* FAULTLOG_CFG_H_ */
@@ -15,6 +15,30 @@
 #include "ECUAL/Led/Led.h"
 #include "MCAL/GPT/Gpt.h"
 
+/* OS_OVERRUN_HOOK streams the overruns as trace events */
+#include "Services_Layer/Trace/Trace_Hooks.h"
+
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+/* The "Os_Regs.h" is not AUTOSAR file so there is no version checking */
+#include "Os_Regs.h"
+#endif
+
+#if defined(HOST_SIM)
+/* Host simulation build, the virtual clock runs the SysTick interrupt when the scheduler is idle */
+#include "Simulation/Sim.h"
+
+#if (OS_PREEMPTIVE_KERNEL == STD_ON) && !defined(OS_KERNEL_TEST)
+#error "The preemptive kernel can not be simulated on the host (only Simulation/Os_Kernel_Test.c models PendSV_Handler)"
+#endif
+
+#define Enable_Exceptions()
+#define Disable_Exceptions()
+#define Enable_Faults()
+#define Disable_Faults()
+
+/* The CPU sleep is where the virtual time advances to the next SysTick interrupt */
+#define Wait_For_Interrupt()   Sim_Idle()
+#else
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
 
@@ -27,16 +51,199 @@
 /* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
 #define Disable_Faults()       __asm(" CPSID F ")
 
+/* Wait For Interrupt ... This Macro puts the CPU in sleep until an interrupt is pending, it wakes up even if the I-bit is set */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+#endif
+
+#if (OS_NUMBER_OF_TASKS > 32U)
+#error "The task activation bitmap holds up to 32 tasks"
+#endif
+
+#if defined(HOST_SIM)
+/* Host simulation build, atomic read-modify-write built-ins of the host compiler */
+#define OS_ATOMIC_SET_BIT(VAR, BIT)         ((void)__sync_fetch_and_or(&(VAR), (1UL << (BIT))))
+#define OS_ATOMIC_CLEAR_BIT(VAR, BIT)       ((void)__sync_fetch_and_and(&(VAR), ~(1UL << (BIT))))
+#else
+/* Bit-band alias of a bit in the SRAM, a single store to it sets or clears the bit atomically (no read-modify-write) */
+#define OS_BITBAND_SRAM(VAR, BIT)           (*((volatile uint32 *)(0x22000000UL + ((((uint32)&(VAR)) - 0x20000000UL) * 32UL) + ((BIT) * 4UL))))
+#define OS_ATOMIC_SET_BIT(VAR, BIT)         (OS_BITBAND_SRAM(VAR, BIT) = 1UL)
+#define OS_ATOMIC_CLEAR_BIT(VAR, BIT)       (OS_BITBAND_SRAM(VAR, BIT) = 0UL)
+#endif
+
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+/* Count the leading zeros of a 32-bit value using the CLZ instruction */
+#if defined(__TI_ARM__)
+#define OS_COUNT_LEADING_ZEROS(VALUE)       ((uint32)_norm(VALUE))
+#else
+#define OS_COUNT_LEADING_ZEROS(VALUE)       ((uint32)__builtin_clz(VALUE))
+#endif
+
+#define OS_PENDSV_SET_MASK                  0x10000000     // PENDSVSET bit mask in the INTCTRL register.
+#define OS_PENDSV_PRIORITY_MASK             0xFF1FFFFF     // PendSV priority bit mask in NVIC_SYSTEM_PRI3_REG.
+#define OS_PENDSV_INTERRUPT_PRIORITY        7              // Lowest priority, the switch runs after all the interrupts.
+#define OS_PENDSV_PRIORITY_BITS_POS         21
+
+#define OS_INITIAL_XPSR                     0x01000000     // Thumb state bit.
+#define OS_INITIAL_EXC_RETURN               0xFFFFFFFD     // Return to thread mode using PSP, basic frame (no FPU).
+
+/* Priority of the idle task, it is always ready so the ready bitmap is never zero */
+#define OS_IDLE_PRIORITY                    (0U)
+
+/* Task states in the preemptive kernel */
+#define OS_TASK_SUSPENDED                   (0U)
+#define OS_TASK_ACTIVE                      (1U)           // Ready or running (including preempted).
+#define OS_TASK_TERMINATING                 (2U)           // Completed, its stack is in use until PendSV_Handler switches away.
+#endif
+
 
 /*******************************************************************************
  *                  Special Global variable for "Os.c" only                    *
  *******************************************************************************/
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Global variable store the Os Time in ticks (one tick every OS_BASE_TIME ms), it is only written by the timer interrupt */
+static volatile uint32 g_Time_Tick_Count = 0;
+
+#if (OS_PREEMPTIVE_KERNEL == STD_OFF)
+/* Global variable store the last tick processed by the scheduler, the ticks after it up to g_Time_Tick_Count are pending */
+static uint32 g_Processed_Tick_Count = 0;
+#endif
+
+/* Number of ticks that arrived while the previous ticks were still pending (processed late) */
+static uint32 g_Late_Tick_Count = 0;
+
+/* Number of the late ticks dropped without processing (skip policy or above OS_MAX_CATCH_UP_TICKS) */
+static uint32 g_Lost_Tick_Count = 0;
+
+/* Number of deadline misses of each task */
+static uint32 g_Task_Deadline_Misses[OS_NUMBER_OF_TASKS];
+
+/* The offset in ticks used for each task, initialized from the tasks table and updated by the offset optimizer */
+static uint32 g_Task_Offset[OS_NUMBER_OF_TASKS];
+
+/* The tick number of the next release for each task */
+static uint32 g_Task_Next_Release[OS_NUMBER_OF_TASKS];
+
+/* Nesting counter of Os_SuspendAllInterrupts */
+static uint32 g_Suspend_Nesting = 0;
+
+#if (OS_PREEMPTIVE_KERNEL == STD_OFF)
+/* Activation bitmap, bit n is set by Os_ActivateTask when task n is activated and cleared when it is dispatched */
+static volatile uint32 g_Task_Activation_Bitmap = 0;
+#endif
+
+#if (OS_TICKLESS_MODE == STD_ON)
+/* Number of ticks added to the Os time by the next SysTick interrupt, it is 1 unless the next interrupt was delayed */
+static volatile uint32 g_Tick_Interval = 1;
+
+#if (OS_PREEMPTIVE_KERNEL == STD_OFF)
+/* Number of ticks slept by the scheduler, the ticks before the last one of them have no task release */
+static uint32 g_Sleep_Ticks = 1;
+#endif
+#endif
+
+#if (OS_TASK_STATS_API == STD_ON)
+/* DWT cycle counter value captured at the last SysTick interrupt */
+static volatile uint32 g_Tick_Time_Stamp = 0;
+
+/* Structure to hold the running statistics of a task, the sums are used to calculate the averages */
+typedef struct
+{
+    uint32 Activations;
+    uint32 Execution_Min;
+    uint32 Execution_Max;
+    uint64 Execution_Sum;
+    uint32 Jitter_Min;
+    uint32 Jitter_Max;
+    uint64 Jitter_Sum;
+    uint32 Histogram[OS_STATS_HISTOGRAM_BINS];
+}Os_TaskStatsRecordType;
+
+/* The statistics of each task */
+static Os_TaskStatsRecordType g_Task_Stats[OS_NUMBER_OF_TASKS];
+
+/* DWT cycle counter value at the release of the current activation of each task (tick or Os_ActivateTask) */
+static uint32 g_Task_Release_Time_Stamp[OS_NUMBER_OF_TASKS];
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+/* Sum of the execution times of the completed task runs, a run subtracts the part added while it was preempted */
+static uint32 g_Executed_Cycles = 0;
+#endif
+#endif
+
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+/* Task control block, Stack_Ptr and State MUST be the first members (offsets 0 and 4) as they are used by PendSV_Handler */
+typedef struct
+{
+    uint32 * Stack_Ptr;
+    uint8 State;
+    boolean Activation_Pending;     /* Released while terminating, started by Os_TaskTerminated */
+}Os_TcbType;
+
+/* Stacks of the tasks and the idle task, declared as uint64 to keep the 8 bytes alignment of the exception frames */
+static uint64 g_Task_Stack[OS_NUMBER_OF_TASKS][OS_TASK_STACK_SIZE / 8];
+static uint64 g_Idle_Stack[OS_TASK_STACK_SIZE / 8];
+
+/* Task control blocks of the tasks and the idle task */
+static Os_TcbType g_Task_Tcb[OS_NUMBER_OF_TASKS];
+static Os_TcbType g_Idle_Tcb;
+
+/* Task control block of each priority (bit number in the ready bitmap) */
+static Os_TcbType * g_Priority_Tcb[32];
+
+/* Ready bitmap, bit n is set when the task with priority n is ready or preempted */
+static uint32 g_Ready_Bitmap = (1UL << OS_IDLE_PRIORITY);
+
+/* The release tick of the current activation of each task used for the deadline check */
+static uint32 g_Task_Activation_Release[OS_NUMBER_OF_TASKS];
+
+/* Flag set when the kernel runs the tasks on their own stacks */
+static volatile boolean g_Kernel_Started = FALSE;
+#endif
+
+/* The running and the next task control blocks and the context switch cycles {last, maximum, sum}, used by PendSV_Handler */
+void * volatile Os_CurrentTcb = NULL_PTR;
+void * volatile Os_NextTcb = NULL_PTR;
+volatile uint32 Os_ContextSwitchCycles[3] = {0, 0, 0};
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Os_InitTasks(void);
+
+static void Os_DispatchTask(Os_TaskType TaskID);
+
+#if (OS_TICKLESS_MODE == STD_ON)
+static uint32 Os_TicklessIdle(void);
+#endif
+
+#if (OS_PREEMPTIVE_KERNEL == STD_OFF)
+static void Os_ProcessTick(uint32 Tick);
+
+static void Os_RunActivatedTasks(void);
+#endif
+
+/* Called by PendSV_Handler when it switches away from a terminating task, empty in the cooperative kernel */
+void Os_TaskTerminated(void);
+
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+/* Defined in Os_ContextSwitch.asm, move to the idle task stack and call the idle function */
+extern void Os_KernelStart(uint32 * IdleStackTop, void (*IdleFunction)(void));
+
+static void Os_KernelTick(uint32 Tick);
+
+static boolean Os_ReleaseTask(Os_TaskType TaskID, uint32 ReleaseTick);
+
+static void Os_Reschedule(void);
+
+static void Os_PrepareTaskStack(Os_TaskType TaskID);
+
+static void Os_TaskEntry(Os_TaskType TaskID);
+
+static void Os_TerminateTask(Os_TaskType TaskID);
+
+static void Os_IdleTask(void);
+#endif
 
 /*******************************************************************************
  *                          Function definitions                               *
@@ -52,6 +259,15 @@ static uint8 g_New_Time_Tick_Flag = 0;
 
 void Os_start(void)
 {
+    /* Load the tasks offsets and calculate the first release of each task */
+    Os_InitTasks();
+
+#if (OS_TASK_STATS_API == STD_ON)
+    /* Start the cycle counter used to measure the tasks and clear the statistics */
+    Dwt_CycleCounterInit();
+    Os_ResetTaskStats();
+#endif
+
     /* Global Interrupts Enable */
     Enable_Exceptions();
 
@@ -74,13 +290,26 @@ void Os_start(void)
 /*********************************************************************************************/
 
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
-void Os_NewTimerTick(void)
+FUNC_RAM void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+#if (OS_TASK_STATS_API == STD_ON)
+    /* Capture the time of the tick to measure the activation jitter of the released tasks */
+    g_Tick_Time_Stamp = Dwt_GetCycleCount();
+#endif
+
+#if (OS_TICKLESS_MODE == STD_ON)
+    /* Advance the Os time by the programmed interval, the next interrupt is one tick later unless it is delayed again */
+    g_Time_Tick_Count += g_Tick_Interval;
+    g_Tick_Interval = 1;
+#else
+    /* Increment the Os time by one tick (OS_BASE_TIME), the scheduler sees it as a pending tick */
+    g_Time_Tick_Count++;
+#endif
 
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+    /* Activate the released tasks and switch to the highest priority one */
+    Os_KernelTick(g_Time_Tick_Count);
+#endif
 }
 
 /*********************************************************************************************/
@@ -88,47 +317,918 @@ void Os_NewTimerTick(void)
 /* Description: The Engine of the Os Scheduler used for switch between different tasks */
 void Os_Scheduler(void)
 {
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+    /* Start the cycle counter used to measure the context switch */
+    Dwt_CycleCounterInit();
+
+    /* Assign the lowest priority to PendSV so the context switch runs after all the interrupts */
+    NVIC_SYSTEM_PRI3_REG = (NVIC_SYSTEM_PRI3_REG & OS_PENDSV_PRIORITY_MASK) | (OS_PENDSV_INTERRUPT_PRIORITY << OS_PENDSV_PRIORITY_BITS_POS);
+
+    /* The scheduler loop becomes the idle task, the tasks are dispatched by the SysTick interrupt */
+    g_Priority_Tcb[OS_IDLE_PRIORITY] = &g_Idle_Tcb;
+    g_Idle_Tcb.State = OS_TASK_ACTIVE;
+    Os_CurrentTcb    = &g_Idle_Tcb;
+
+    Os_KernelStart((uint32 *)&g_Idle_Stack[OS_TASK_STACK_SIZE / 8], Os_IdleTask);
+#else
+    uint32 current_tick = 0;
+    uint32 pending_ticks = 0;
+
     while(1)
     {
+        /* The tasks activated by the interrupts run at the first opportunity */
+        Os_RunActivatedTasks();
+
+        /* Take one copy of the Os time as it is updated by the timer interrupt */
+        current_tick  = g_Time_Tick_Count;
+        pending_ticks = current_tick - g_Processed_Tick_Count;
+
         /* Code is only executed in case there is a new timer tick */
-        if(g_New_Time_Tick_Flag == 1)
-        {
-            switch(g_Time_Tick_Count)
-            {
-            case 20:
-                    Button_Task();
-                    g_New_Time_Tick_Flag = 0;
-                    break;
-            case 100:
-                    Button_Task();
-                    g_New_Time_Tick_Flag = 0;
-                    break;
-            case 40:
-                   Button_Task();
-                   Led_Task();
-                   g_New_Time_Tick_Flag = 0;
-                   break;
-            case 80:
-                    Button_Task();
-                    Led_Task();
-                    g_New_Time_Tick_Flag = 0;
-                    break;
-            case 60:
-                    Button_Task();
-                    App_Task();
-                    g_New_Time_Tick_Flag = 0;
-                    break;
-            case 120:
-                    Button_Task();
-                    App_Task();
-                    Led_Task();
-                    g_New_Time_Tick_Flag = 0;
-                    g_Time_Tick_Count = 0;
-                    break;
+        if(pending_ticks != 0)
+        {
+#if (OS_TICKLESS_MODE == STD_ON)
+            /* The slept ticks have no release so they are not lost, only the last one of them is processed */
+            g_Processed_Tick_Count += g_Sleep_Ticks - 1;
+            pending_ticks -= g_Sleep_Ticks - 1;
+            g_Sleep_Ticks = 1;
+#endif
+            if(pending_ticks > 1)
+            {
+                /* The previous round took longer than OS_BASE_TIME and the ticks were merged */
+                g_Late_Tick_Count += pending_ticks - 1;
+                OS_OVERRUN_HOOK(pending_ticks - 1);
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+#if (OS_OVERRUN_POLICY == OS_OVERRUN_CATCH_UP)
+            if(pending_ticks <= OS_MAX_CATCH_UP_TICKS)
+            {
+                /* Process the pending ticks one by one in order, exactly as if they were not merged */
+                while(g_Processed_Tick_Count != current_tick)
+                {
+                    g_Processed_Tick_Count++;
+                    Os_ProcessTick(g_Processed_Tick_Count);
+                }
+            }
+            else
+#endif
+            {
+                /* Jump to the current tick, the overdue tasks run once and the late ticks are lost */
+                g_Lost_Tick_Count += pending_ticks - 1;
+                g_Processed_Tick_Count = current_tick;
+                Os_ProcessTick(current_tick);
+            }
+        }
+#if (OS_TICKLESS_MODE == STD_ON)
+        else
+        {
+            /* Sleep up to the next task release, the interrupts are disabled so a tick arriving now wakes the CPU at once */
+            Disable_Exceptions();
+            if((current_tick == g_Time_Tick_Count) && (0 == g_Task_Activation_Bitmap))
+            {
+                g_Sleep_Ticks = Os_TicklessIdle();
+                Wait_For_Interrupt();
+            }
+            else
+            {
+                /* No Action Required */
+            }
+            Enable_Exceptions();
+        }
+#elif defined(HOST_SIM)
+        else
+        {
+            /* Nothing to run, advance the virtual time to the next SysTick interrupt */
+            Sim_Idle();
+        }
+#endif
+    }
+#endif
+}
+
+/*********************************************************************************************/
+
+#if (OS_TICKLESS_MODE == STD_ON)
+/*
+ * Description: Program the next SysTick interrupt at the nearest task release and return the number
+ *              of ticks to it. Called with the interrupts disabled after all the released tasks ran.
+ */
+static uint32 Os_TicklessIdle(void)
+{
+    Os_TaskType TaskID = 0;
+    uint32 next_release = 0;
+    uint32 interval = 0xFFFFFFFF;
+
+    /* The interval of the pending interrupt was already set, the Os time is the last interrupt tick */
+    if(1 == g_Tick_Interval)
+    {
+        for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+        {
+            next_release = g_Task_Next_Release[TaskID] - g_Time_Tick_Count;
+            if((0 != Os_TasksConfigurations[TaskID].Period) && (next_release < interval))
+            {
+                interval = next_release;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+
+        if(interval > 0xFFFF)
+        {
+            interval = 0xFFFF;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+
+        /* The timer may shorten the interval (24-bit counter), the time base is advanced by the programmed one */
+        g_Tick_Interval = SysTick_SetNextInterrupt((uint16)interval);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return g_Tick_Interval;
+}
+#endif
+
+/*********************************************************************************************/
+
+#if (OS_PREEMPTIVE_KERNEL == STD_OFF)
+/*
+ * Description: Dispatch the tasks released at or before the given tick in the order of the tasks table.
+ *              The releases older than the given tick are dropped and counted as deadline misses,
+ *              the task runs once for its latest release.
+ */
+static void Os_ProcessTick(uint32 Tick)
+{
+    Os_TaskType TaskID = 0;
+    uint32 period = 0;
+    uint32 missed = 0;
+    uint32 release = 0;
+
+    for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+    {
+        release = g_Task_Next_Release[TaskID];
+
+        /* The signed difference keeps the check correct when the tick counter wraps around, the event tasks have no release */
+        if((0 != Os_TasksConfigurations[TaskID].Period) && ((sint32)(Tick - release) >= 0))
+        {
+            period = Os_TasksConfigurations[TaskID].Period / OS_BASE_TIME;
+            missed = (Tick - release) / period;
+            release += missed * period;
+            g_Task_Deadline_Misses[TaskID] += missed;
+            g_Task_Next_Release[TaskID] = release + period;
+
+#if (OS_TASK_STATS_API == STD_ON)
+            g_Task_Release_Time_Stamp[TaskID] = g_Tick_Time_Stamp;
+#endif
+            Os_DispatchTask(TaskID);
+
+            /* The task missed its deadline if it completed after its next release */
+            if((g_Time_Tick_Count - release) >= period)
+            {
+                g_Task_Deadline_Misses[TaskID]++;
             }
+            else
+            {
+                /* No Action Required */
+            }
+
+            /* The activated tasks do not wait for the rest of the tasks released in this tick */
+            Os_RunActivatedTasks();
+        }
+        else
+        {
+            /* No Action Required */
         }
+    }
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Dispatch the tasks activated by Os_ActivateTask in the order of the tasks table until
+ *              there is no pending activation. The activation bit is cleared before the task runs so
+ *              an activation during the run is kept for the next run.
+ */
+static void Os_RunActivatedTasks(void)
+{
+    Os_TaskType TaskID = 0;
 
+    while(0 != g_Task_Activation_Bitmap)
+    {
+        for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+        {
+            if(0 != (g_Task_Activation_Bitmap & (1UL << TaskID)))
+            {
+                OS_ATOMIC_CLEAR_BIT(g_Task_Activation_Bitmap, TaskID);
+                Os_DispatchTask(TaskID);
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
     }
+}
+
+#endif
+
+/*********************************************************************************************/
+
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+/*
+ * Description: Called by the SysTick interrupt in the preemptive kernel, activate the released tasks
+ *              and request a context switch if a higher priority task became ready.
+ *              A release of a task that is still active is lost and counted as a deadline miss, a release
+ *              of a terminating task is kept pending until PendSV_Handler has left its stack.
+ */
+static void Os_KernelTick(uint32 Tick)
+{
+    Os_TaskType TaskID = 0;
+    uint32 period = 0;
 
+    for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+    {
+        if((0 != Os_TasksConfigurations[TaskID].Period) && ((sint32)(Tick - g_Task_Next_Release[TaskID]) >= 0))
+        {
+            period = Os_TasksConfigurations[TaskID].Period / OS_BASE_TIME;
+            if(TRUE == Os_ReleaseTask(TaskID, Tick))
+            {
+#if (OS_TASK_STATS_API == STD_ON)
+                g_Task_Release_Time_Stamp[TaskID] = g_Tick_Time_Stamp;
+#endif
+            }
+            else
+            {
+                g_Task_Deadline_Misses[TaskID]++;
+            }
+            g_Task_Next_Release[TaskID] += period;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+
+    Os_Reschedule();
 }
+
+/*********************************************************************************************/
+
+/*
+ * Description: Start an activation of the required task released at the given tick. Called with the
+ *              interrupts disabled or from an interrupt. A terminating task still runs on its stack until
+ *              PendSV_Handler switches away, so its activation is kept pending and Os_TaskTerminated
+ *              starts it. Return FALSE if the task is active or already has a pending activation.
+ */
+static boolean Os_ReleaseTask(Os_TaskType TaskID, uint32 ReleaseTick)
+{
+    boolean released = FALSE;
+
+    if(OS_TASK_SUSPENDED == g_Task_Tcb[TaskID].State)
+    {
+        g_Task_Activation_Release[TaskID] = ReleaseTick;
+        Os_PrepareTaskStack(TaskID);
+        g_Task_Tcb[TaskID].State = OS_TASK_ACTIVE;
+        g_Ready_Bitmap |= (1UL << Os_TasksConfigurations[TaskID].Priority);
+        released = TRUE;
+    }
+    else if((OS_TASK_TERMINATING == g_Task_Tcb[TaskID].State) && (FALSE == g_Task_Tcb[TaskID].Activation_Pending))
+    {
+        g_Task_Activation_Release[TaskID] = ReleaseTick;
+        g_Task_Tcb[TaskID].Activation_Pending = TRUE;
+        released = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return released;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Called by PendSV_Handler with the interrupts disabled after it dropped the context of
+ *              the terminating running task (Os_CurrentTcb), its stack is not used any more. Suspend
+ *              the task or start its pending activation and select the next task again.
+ */
+void Os_TaskTerminated(void)
+{
+    Os_TcbType * Tcb_Ptr = (Os_TcbType *)Os_CurrentTcb;
+    Os_TaskType TaskID = (Os_TaskType)(Tcb_Ptr - &g_Task_Tcb[0]);
+
+    Tcb_Ptr->State = OS_TASK_SUSPENDED;
+    if(TRUE == Tcb_Ptr->Activation_Pending)
+    {
+        Tcb_Ptr->Activation_Pending = FALSE;
+        (void)Os_ReleaseTask(TaskID, g_Task_Activation_Release[TaskID]);
+
+        /* The restarted task may preempt the task selected at the termination */
+        Os_NextTcb = g_Priority_Tcb[31 - OS_COUNT_LEADING_ZEROS(g_Ready_Bitmap)];
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Select the highest priority ready task in O(1) from the ready bitmap and pend
+ *              PendSV if it is not the running task. Called with the interrupts disabled or
+ *              from the SysTick interrupt.
+ */
+static void Os_Reschedule(void)
+{
+    Os_TcbType * Next_Tcb_Ptr = NULL_PTR;
+
+    if(TRUE == g_Kernel_Started)
+    {
+        Next_Tcb_Ptr = g_Priority_Tcb[31 - OS_COUNT_LEADING_ZEROS(g_Ready_Bitmap)];
+        if(Next_Tcb_Ptr != Os_CurrentTcb)
+        {
+            Os_NextTcb = Next_Tcb_Ptr;
+            NVIC_SYSTEM_INTCTRL_REG = OS_PENDSV_SET_MASK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Build the initial stack of a task activation as if it was preempted at the first
+ *              instruction of Os_TaskEntry, PendSV_Handler restores it as any preempted task.
+ */
+static void Os_PrepareTaskStack(Os_TaskType TaskID)
+{
+    uint32 * Stack_Ptr = (uint32 *)&g_Task_Stack[TaskID][OS_TASK_STACK_SIZE / 8];
+    uint8 reg = 0;
+
+    /* Frame restored by the hardware on the exception return: xPSR, PC, LR, R12, R3, R2, R1, R0 */
+    *(--Stack_Ptr) = OS_INITIAL_XPSR;
+    *(--Stack_Ptr) = ((uint32)Os_TaskEntry) & ~1UL;   /* The Thumb bit is given by xPSR */
+    *(--Stack_Ptr) = 0;                                /* Os_TaskEntry never returns */
+    for(reg = 0; reg < 4; reg++)
+    {
+        *(--Stack_Ptr) = 0;                            /* R12, R3, R2, R1 */
+    }
+    *(--Stack_Ptr) = TaskID;                           /* R0 is the parameter of Os_TaskEntry */
+
+    /* Frame restored by PendSV_Handler: EXC_RETURN, R11 to R4 */
+    *(--Stack_Ptr) = OS_INITIAL_EXC_RETURN;
+    for(reg = 0; reg < 8; reg++)
+    {
+        *(--Stack_Ptr) = 0;
+    }
+
+    g_Task_Tcb[TaskID].Stack_Ptr = Stack_Ptr;
+}
+
+/*********************************************************************************************/
+
+/* Description: Entry of every task activation, run the task as a basic task then terminate it */
+static void Os_TaskEntry(Os_TaskType TaskID)
+{
+    Os_DispatchTask(TaskID);
+    Os_TerminateTask(TaskID);
+
+    /* PendSV is taken here and this stack is not resumed any more */
+    while(1)
+    {
+
+    }
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Terminate the running task and switch to the next ready task. The task stays
+ *              TERMINATING while it runs on its stack up to PendSV_Handler, a release in between
+ *              is kept pending instead of building a new stack under the running code.
+ */
+static void Os_TerminateTask(Os_TaskType TaskID)
+{
+    /* The task missed its deadline if it completed after its next release (the event tasks have no deadline) */
+    if((0 != Os_TasksConfigurations[TaskID].Period)
+       && ((g_Time_Tick_Count - g_Task_Activation_Release[TaskID]) >= (Os_TasksConfigurations[TaskID].Period / OS_BASE_TIME)))
+    {
+        g_Task_Deadline_Misses[TaskID]++;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    /* PendSV_Handler suspends the task once it switched away (Os_TaskTerminated) */
+    Disable_Exceptions();
+    g_Task_Tcb[TaskID].State = OS_TASK_TERMINATING;
+    g_Ready_Bitmap &= ~(1UL << Os_TasksConfigurations[TaskID].Priority);
+    Os_Reschedule();
+    Enable_Exceptions();
+}
+
+/*********************************************************************************************/
+
+/* Description: The idle task runs when there is no ready task */
+static void Os_IdleTask(void)
+{
+    /* The kernel is started from the idle task as PendSV must not be taken before the thread mode uses PSP */
+    Disable_Exceptions();
+    g_Kernel_Started = TRUE;
+    Os_Reschedule();
+    Enable_Exceptions();
+
+    while(1)
+    {
+#if (OS_TICKLESS_MODE == STD_ON)
+        /* Sleep up to the next task release, a tick arriving after disabling the interrupts wakes the CPU at once */
+        Disable_Exceptions();
+        (void)Os_TicklessIdle();
+        Wait_For_Interrupt();
+        Enable_Exceptions();
+#endif
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the cycles spent in the last context switch and the maximum measured one */
+void Os_GetContextSwitchCycles(uint32 * LastPtr, uint32 * MaxPtr)
+{
+    if((NULL_PTR != LastPtr) && (NULL_PTR != MaxPtr))
+    {
+        *LastPtr = Os_ContextSwitchCycles[0];
+        *MaxPtr  = Os_ContextSwitchCycles[1];
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#else
+/*
+ * Description: PendSV_Handler is always in the vector table and references this function, the cooperative
+ *              kernel never pends PendSV so it is never called.
+ */
+void Os_TaskTerminated(void)
+{
+}
+#endif
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the deadline misses of the required task (completed after its next release) */
+uint32 Os_GetDeadlineMissCount(Os_TaskType TaskID)
+{
+    uint32 misses = 0;
+
+    if(TaskID < OS_NUMBER_OF_TASKS)
+    {
+        misses = g_Task_Deadline_Misses[TaskID];
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return misses;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the ticks that arrived while the previous ticks were still pending */
+uint32 Os_GetLateTickCount(void)
+{
+    return g_Late_Tick_Count;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the late ticks dropped without processing, their releases were missed */
+uint32 Os_GetLostTickCount(void)
+{
+    return g_Lost_Tick_Count;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the Os time in ticks (OS_BASE_TIME) since the start, it keeps counting in the tickless mode */
+uint32 Os_GetTickCount(void)
+{
+    return g_Time_Tick_Count;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Activate the required task, it is callable from the interrupts and the tasks.
+ *              The task runs at the next opportunity of the scheduler, in the cooperative scheduler
+ *              after the running task and in the preemptive kernel at once if it has a higher priority.
+ *              Return E_NOT_OK for an invalid task or if the task is already activated (not queued).
+ */
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskID)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(TaskID < OS_NUMBER_OF_TASKS)
+    {
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+        /* The kernel state is shared with the SysTick and the other interrupts */
+        Os_SuspendAllInterrupts();
+        if(TRUE == Os_ReleaseTask(TaskID, g_Time_Tick_Count))
+        {
+#if (OS_TASK_STATS_API == STD_ON)
+            g_Task_Release_Time_Stamp[TaskID] = Dwt_GetCycleCount();
+#endif
+            Os_Reschedule();
+            ret = E_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Os_ResumeAllInterrupts();
+#else
+        if(0 == (g_Task_Activation_Bitmap & (1UL << TaskID)))
+        {
+#if (OS_TASK_STATS_API == STD_ON)
+            g_Task_Release_Time_Stamp[TaskID] = Dwt_GetCycleCount();
+#endif
+            /* Single store to the bit-band alias, no interrupt has to be disabled */
+            OS_ATOMIC_SET_BIT(g_Task_Activation_Bitmap, TaskID);
+            ret = E_OK;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+#endif
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/* Description: Disable all the interrupts, the calls can be nested and the interrupts are enabled by the last Os_ResumeAllInterrupts */
+void Os_SuspendAllInterrupts(void)
+{
+    Disable_Exceptions();
+    g_Suspend_Nesting++;
+}
+
+/*********************************************************************************************/
+
+/* Description: Restore the interrupts disabled by Os_SuspendAllInterrupts */
+void Os_ResumeAllInterrupts(void)
+{
+    if(g_Suspend_Nesting > 0)
+    {
+        g_Suspend_Nesting--;
+        if(0 == g_Suspend_Nesting)
+        {
+            Enable_Exceptions();
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Run the required task and update its statistics. In the preemptive kernel the execution
+ *              time excludes the runs of the higher priority tasks that preempted it and their context
+ *              switches, they are the growth of g_Executed_Cycles and of the context switch cycles sum.
+ */
+static void Os_DispatchTask(Os_TaskType TaskID)
+{
+#if (OS_TASK_STATS_API == STD_ON)
+    Os_TaskStatsRecordType * Stats_Ptr = &g_Task_Stats[TaskID];
+    uint32 start_time = 0;
+    uint32 execution_time = 0;
+    uint32 jitter = 0;
+    uint32 bin = 0;
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+    uint32 start_executed = 0;
+    uint32 start_switches = 0;
+
+    /* The time and the sums are read together, a preemption between them would be counted in the wrong run */
+    Disable_Exceptions();
+    start_time     = Dwt_GetCycleCount();
+    start_executed = g_Executed_Cycles;
+    start_switches = Os_ContextSwitchCycles[2];
+    Enable_Exceptions();
+#else
+    start_time = Dwt_GetCycleCount();
+#endif
+    jitter = start_time - g_Task_Release_Time_Stamp[TaskID];
+#endif
+
+    Os_TasksConfigurations[TaskID].Task_Ptr();
+
+    OS_POST_TASK_HOOK(TaskID);
+
+#if (OS_TASK_STATS_API == STD_ON)
+    /* The unsigned subtractions give the correct times even if the counters wrapped around */
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+    Disable_Exceptions();
+    execution_time = (Dwt_GetCycleCount() - start_time) - (g_Executed_Cycles - start_executed)
+                     - (Os_ContextSwitchCycles[2] - start_switches);
+    g_Executed_Cycles += execution_time;
+    Enable_Exceptions();
+#else
+    execution_time = Dwt_GetCycleCount() - start_time;
+#endif
+
+    Stats_Ptr->Activations++;
+    Stats_Ptr->Execution_Sum += execution_time;
+    Stats_Ptr->Jitter_Sum    += jitter;
+    if(execution_time < Stats_Ptr->Execution_Min)
+    {
+        Stats_Ptr->Execution_Min = execution_time;
+    }
+    if(execution_time > Stats_Ptr->Execution_Max)
+    {
+        Stats_Ptr->Execution_Max = execution_time;
+    }
+    if(jitter < Stats_Ptr->Jitter_Min)
+    {
+        Stats_Ptr->Jitter_Min = jitter;
+    }
+    if(jitter > Stats_Ptr->Jitter_Max)
+    {
+        Stats_Ptr->Jitter_Max = jitter;
+    }
+    bin = execution_time >> OS_STATS_HISTOGRAM_SHIFT;
+    if(bin >= OS_STATS_HISTOGRAM_BINS)
+    {
+        bin = OS_STATS_HISTOGRAM_BINS - 1;
+    }
+    Stats_Ptr->Histogram[bin]++;
+#endif
+}
+
+/*********************************************************************************************/
+
+#if (OS_TASK_STATS_API == STD_ON)
+/* Description: Copy the execution time and jitter statistics of the required task, return E_NOT_OK for invalid parameters */
+Std_ReturnType Os_GetTaskStats(Os_TaskType TaskID, Os_TaskStatsType * StatsPtr)
+{
+    const Os_TaskStatsRecordType * Stats_Ptr = NULL_PTR;
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 bin = 0;
+
+    if((TaskID < OS_NUMBER_OF_TASKS) && (NULL_PTR != StatsPtr))
+    {
+        Stats_Ptr = &g_Task_Stats[TaskID];
+
+        StatsPtr->Activations = Stats_Ptr->Activations;
+        StatsPtr->Execution_Max = Stats_Ptr->Execution_Max;
+        StatsPtr->Jitter_Max    = Stats_Ptr->Jitter_Max;
+        if(0 == Stats_Ptr->Activations)
+        {
+            /* Nothing measured yet */
+            StatsPtr->Execution_Min = 0;
+            StatsPtr->Execution_Avg = 0;
+            StatsPtr->Jitter_Min    = 0;
+            StatsPtr->Jitter_Avg    = 0;
+        }
+        else
+        {
+            StatsPtr->Execution_Min = Stats_Ptr->Execution_Min;
+            StatsPtr->Execution_Avg = (uint32)(Stats_Ptr->Execution_Sum / Stats_Ptr->Activations);
+            StatsPtr->Jitter_Min    = Stats_Ptr->Jitter_Min;
+            StatsPtr->Jitter_Avg    = (uint32)(Stats_Ptr->Jitter_Sum / Stats_Ptr->Activations);
+        }
+        for(bin = 0; bin < OS_STATS_HISTOGRAM_BINS; bin++)
+        {
+            StatsPtr->Histogram[bin] = Stats_Ptr->Histogram[bin];
+        }
+        ret = E_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/* Description: Clear the statistics of all the tasks */
+void Os_ResetTaskStats(void)
+{
+    Os_TaskType TaskID = 0;
+    uint8 bin = 0;
+
+    for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+    {
+        g_Task_Stats[TaskID].Activations   = 0;
+        g_Task_Stats[TaskID].Execution_Min = 0xFFFFFFFF;
+        g_Task_Stats[TaskID].Execution_Max = 0;
+        g_Task_Stats[TaskID].Execution_Sum = 0;
+        g_Task_Stats[TaskID].Jitter_Min    = 0xFFFFFFFF;
+        g_Task_Stats[TaskID].Jitter_Max    = 0;
+        g_Task_Stats[TaskID].Jitter_Sum    = 0;
+        for(bin = 0; bin < OS_STATS_HISTOGRAM_BINS; bin++)
+        {
+            g_Task_Stats[TaskID].Histogram[bin] = 0;
+        }
+    }
+}
+#endif
+
+/*********************************************************************************************/
+
+/* Description: Return the offset in ms currently used for the required task */
+uint16 Os_GetTaskOffset(Os_TaskType TaskID)
+{
+    uint16 offset = 0;
+
+    if(TaskID < OS_NUMBER_OF_TASKS)
+    {
+        offset = (uint16)(g_Task_Offset[TaskID] * OS_BASE_TIME);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return offset;
+}
+
+/*********************************************************************************************/
+
+#if (OS_OFFSET_OPTIMIZATION == STD_ON)
+/* Description:
+ * Function responsible for assigning the task offsets that minimize the worst-case
+ * per-tick execution load over the hyper-period using the configured execution times.
+ * The tasks are placed one by one starting from the most expensive one, each task takes
+ * the offset that gives the lowest peak load in the ticks it will run in.
+ * A task keeps its configured offset unless another offset is strictly better.
+ */
+void Os_OptimizeOffsets(void)
+{
+    /* Execution load in micro-seconds of every tick in the hyper-period */
+    static uint32 tick_load[OS_MAX_HYPER_PERIOD_TICKS];
+    boolean task_placed[OS_NUMBER_OF_TASKS] = {FALSE};
+    uint32 hyper_period = 1;
+    uint32 period = 0;
+    uint32 a = 0, b = 0, r = 0;
+    uint32 offset = 0, best_offset = 0;
+    uint32 peak = 0, best_peak = 0;
+    uint32 tick = 0;
+    uint8 placed = 0;
+    Os_TaskType TaskID = 0, next = 0;
+
+    /* Calculate the hyper-period as the LCM of all the periods in ticks */
+    for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+    {
+        period = Os_TasksConfigurations[TaskID].Period / OS_BASE_TIME;
+        if(0 == period)
+        {
+            /* The event tasks are not placed, they have no load in the table */
+            task_placed[TaskID] = TRUE;
+            placed++;
+        }
+        else
+        {
+            a = hyper_period;
+            b = period;
+            while(b != 0)
+            {
+                r = a % b;
+                a = b;
+                b = r;
+            }
+            hyper_period = (hyper_period / a) * period;
+            if(hyper_period > OS_MAX_HYPER_PERIOD_TICKS)
+            {
+                /* Table too long to be evaluated, keep the configured offsets */
+                return;
+            }
+        }
+    }
+
+    for(tick = 0; tick < hyper_period; tick++)
+    {
+        tick_load[tick] = 0;
+    }
+
+    for(; placed < OS_NUMBER_OF_TASKS; placed++)
+    {
+        /* Select the most expensive task that is not placed yet */
+        next = OS_NUMBER_OF_TASKS;
+        for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+        {
+            if((FALSE == task_placed[TaskID]) && ((OS_NUMBER_OF_TASKS == next)
+               || (Os_TasksConfigurations[TaskID].Execution_Time > Os_TasksConfigurations[next].Execution_Time)))
+            {
+                next = TaskID;
+            }
+        }
+
+        period = Os_TasksConfigurations[next].Period / OS_BASE_TIME;
+
+        /* Start with the configured offset so that it is only replaced by a strictly better one */
+        best_offset = g_Task_Offset[next];
+        best_peak   = 0;
+        for(tick = best_offset; tick < hyper_period; tick += period)
+        {
+            if(tick_load[tick] > best_peak)
+            {
+                best_peak = tick_load[tick];
+            }
+        }
+
+        for(offset = 0; offset < period; offset++)
+        {
+            peak = 0;
+            for(tick = offset; tick < hyper_period; tick += period)
+            {
+                if(tick_load[tick] > peak)
+                {
+                    peak = tick_load[tick];
+                }
+            }
+            if(peak < best_peak)
+            {
+                best_peak   = peak;
+                best_offset = offset;
+            }
+        }
+
+        /* Add the task load to the ticks it will run in */
+        for(tick = best_offset; tick < hyper_period; tick += period)
+        {
+            tick_load[tick] += Os_TasksConfigurations[next].Execution_Time;
+        }
+
+        g_Task_Offset[next] = best_offset;
+        task_placed[next]   = TRUE;
+    }
+
+    /* Re-calculate the first release of each task with the new offsets */
+    for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+    {
+        period = Os_TasksConfigurations[TaskID].Period / OS_BASE_TIME;
+        g_Task_Next_Release[TaskID] = (g_Task_Offset[TaskID] == 0) ? period : g_Task_Offset[TaskID];
+    }
+}
+#endif
+
+/*********************************************************************************************/
+
+/* Description: Load the configured offsets and calculate the first release tick of each task */
+static void Os_InitTasks(void)
+{
+    Os_TaskType TaskID = 0;
+    uint32 period = 0;
+
+    for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+    {
+        period = Os_TasksConfigurations[TaskID].Period / OS_BASE_TIME;
+        g_Task_Offset[TaskID] = Os_TasksConfigurations[TaskID].Offset / OS_BASE_TIME;
+
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+        g_Task_Tcb[TaskID].State = OS_TASK_SUSPENDED;
+        g_Task_Tcb[TaskID].Activation_Pending = FALSE;
+        g_Priority_Tcb[Os_TasksConfigurations[TaskID].Priority] = &g_Task_Tcb[TaskID];
+#endif
+
+        /* The first tick is tick number 1, so a task with offset 0 is first released at the end of its period */
+        g_Task_Next_Release[TaskID] = (g_Task_Offset[TaskID] == 0) ? period : g_Task_Offset[TaskID];
+    }
+
+#if (OS_OFFSET_OPTIMIZATION == STD_ON)
+    Os_OptimizeOffsets();
+#endif
+}
+
 /*********************************************************************************************/
@@ -14,8 +14,51 @@
 
 #include "Std_Types.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Os Pre-Compile Configuration Header file */
+#include "Os_Cfg.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Os_TaskType used by the OS APIs (index in the tasks table) */
+typedef uint8 Os_TaskType;
+
+/* Description: Structure to configure each task in the Os tasks table:
+ *  1. Pointer to the task function.
+ *  2. The task period in ms (0 for an event task activated only by Os_ActivateTask).
+ *  3. The task offset (first activation phase) in ms.
+ *  4. The task execution time in micro-seconds.
+ *  5. The task priority used by the preemptive kernel (1 to 31, unique, higher value preempts lower value).
+ */
+typedef struct
+{
+    void (*Task_Ptr)(void);
+    uint16 Period;
+    uint16 Offset;
+    uint16 Execution_Time;
+    uint8 Priority;
+}Os_TaskConfigType;
+
+#if (OS_TASK_STATS_API == STD_ON)
+/* Description: Structure to hold the statistics of a task, all the times are in CPU cycles:
+ *  1. Number of the measured activations.
+ *  2. Minimum, maximum and average execution time, without the time preempted by the higher priority tasks.
+ *  3. Minimum, maximum and average activation jitter (delay from the SysTick interrupt or Os_ActivateTask to the task start).
+ *  4. Execution time histogram, bin n counts the runs in [n, n+1) * 2^OS_STATS_HISTOGRAM_SHIFT cycles.
+ */
+typedef struct
+{
+    uint32 Activations;
+    uint32 Execution_Min;
+    uint32 Execution_Max;
+    uint32 Execution_Avg;
+    uint32 Jitter_Min;
+    uint32 Jitter_Max;
+    uint32 Jitter_Avg;
+    uint32 Histogram[OS_STATS_HISTOGRAM_BINS];
+}Os_TaskStatsType;
+#endif
 
 /* Description: 
  * Function responsible for:
@@ -32,4 +75,59 @@ void Os_NewTimerTick(void);
 /* Description: The Engine of the Os Scheduler used for switch between different tasks */
 void Os_Scheduler(void);
 
+#if (OS_OFFSET_OPTIMIZATION == STD_ON)
+/* Description:
+ * Function responsible for assigning the task offsets that minimize the worst-case
+ * per-tick execution load over the hyper-period using the configured execution times.
+ */
+void Os_OptimizeOffsets(void);
+#endif
+
+#if (OS_PREEMPTIVE_KERNEL == STD_ON)
+/* Description: Return the cycles spent in the last context switch and the maximum measured one */
+void Os_GetContextSwitchCycles(uint32 * LastPtr, uint32 * MaxPtr);
+#endif
+
+/* Description: Return the Os time in ticks (OS_BASE_TIME) since the start, it keeps counting in the tickless mode */
+uint32 Os_GetTickCount(void);
+
+/*
+ * Description: Activate the required task, it is callable from the interrupts and the tasks.
+ *              Return E_NOT_OK for an invalid task or if the task is already activated (not queued).
+ */
+Std_ReturnType Os_ActivateTask(Os_TaskType TaskID);
+
+/* Description: Disable all the interrupts, the calls can be nested and the interrupts are enabled by the last Os_ResumeAllInterrupts */
+void Os_SuspendAllInterrupts(void);
+
+/* Description: Restore the interrupts disabled by Os_SuspendAllInterrupts */
+void Os_ResumeAllInterrupts(void);
+
+/* Description: Return the offset in ms currently used for the required task */
+uint16 Os_GetTaskOffset(Os_TaskType TaskID);
+
+/* Description: Return the number of the deadline misses of the required task (completed after its next release) */
+uint32 Os_GetDeadlineMissCount(Os_TaskType TaskID);
+
+/* Description: Return the number of the ticks that arrived while the previous ticks were still pending */
+uint32 Os_GetLateTickCount(void);
+
+/* Description: Return the number of the late ticks dropped without processing, their releases were missed */
+uint32 Os_GetLostTickCount(void);
+
+#if (OS_TASK_STATS_API == STD_ON)
+/* Description: Copy the execution time and jitter statistics of the required task, return E_NOT_OK for invalid parameters */
+Std_ReturnType Os_GetTaskStats(Os_TaskType TaskID, Os_TaskStatsType * StatsPtr);
+
+/* Description: Clear the statistics of all the tasks */
+void Os_ResetTaskStats(void);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Os */
+extern const Os_TaskConfigType Os_TasksConfigurations[OS_NUMBER_OF_TASKS];
+
 #endif /* OS_H_ */
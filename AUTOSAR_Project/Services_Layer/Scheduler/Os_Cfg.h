@@ -0,0 +1,95 @@
+ /******************************************************************************
+ *
+ * Module: OS
+ *
+ * File Name: Os_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Os Scheduler.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Timer counting time in ms */
+#define OS_BASE_TIME                        (20U)
+
+/* Number of the configured tasks in the array of structures in Os_PBcfg.c */
+#define OS_NUMBER_OF_TASKS                  (5U)
+
+/* Task Index in the array of structures in Os_PBcfg.c */
+#define OsConf_BUTTON_TASK_ID               (uint8)0x00
+#define OsConf_APP_TASK_ID                  (uint8)0x01
+#define OsConf_LED_TASK_ID                  (uint8)0x02
+#define OsConf_SWTIMER_TASK_ID              (uint8)0x03
+#define OsConf_FAULTLOG_TASK_ID             (uint8)0x04
+
+/*
+ * Pre-compile option for the preemptive kernel, when it is ON every task runs on its own stack
+ * as a basic task (run to completion) and a released task preempts the running task if it has
+ * a higher priority. The context switch is done in PendSV_Handler (Os_ContextSwitch.asm).
+ * When it is OFF the tasks run cooperatively from the Os_Scheduler loop.
+ * It can be given on the compiler command line to build the host kernel test (Os_Kernel_Test.c).
+ */
+#ifndef OS_PREEMPTIVE_KERNEL
+#define OS_PREEMPTIVE_KERNEL                (STD_OFF)
+#endif
+
+/* Stack size in bytes of every task and of the idle task in the preemptive kernel (multiple of 8) */
+#define OS_TASK_STACK_SIZE                  (512U)
+
+/*
+ * Pre-compile option for the tickless mode, when it is ON the scheduler programs the next SysTick
+ * interrupt at the next task release instead of interrupting every OS_BASE_TIME and the CPU sleeps
+ * (WFI) while no task is ready. The releases stay on the OS_BASE_TIME grid of the same time base.
+ */
+#define OS_TICKLESS_MODE                    (STD_OFF)
+
+/*
+ * Pre-compile option for the offset optimizer, when it is ON the Os_start assigns
+ * the task offsets that minimize the worst-case per-tick execution load instead
+ * of using the configured offsets.
+ */
+#define OS_OFFSET_OPTIMIZATION              (STD_ON)
+
+/* Maximum hyper-period (LCM of all task periods) in ticks handled by the offset optimizer */
+#define OS_MAX_HYPER_PERIOD_TICKS           (64U)
+
+/* Overrun policies, used when a dispatch round takes longer than OS_BASE_TIME and more than one tick is pending */
+#define OS_OVERRUN_CATCH_UP                 (0U)    /* Process every pending tick in order, a task runs once for each missed release */
+#define OS_OVERRUN_SKIP                     (1U)    /* Jump to the current tick, an overdue task runs once and the missed releases are dropped */
+
+/* The policy applied when ticks are pending */
+#define OS_OVERRUN_POLICY                   (OS_OVERRUN_CATCH_UP)
+
+/* Maximum number of pending ticks processed by the catch up policy, above it the missed releases are dropped as in the skip policy */
+#define OS_MAX_CATCH_UP_TICKS               (6U)
+
+/*
+ * Hook called by the scheduler after every task run with the task ID, in the host simulation
+ * it is used to inject execution time into the tasks (overrun and deadline miss regression).
+ */
+#if defined(HOST_SIM)
+#define OS_POST_TASK_HOOK(TaskID)           Sim_PostTaskHook(TaskID)
+#else
+#define OS_POST_TASK_HOOK(TaskID)
+#endif
+
+/*
+ * Pre-compile option for the per-task execution time and activation jitter statistics,
+ * measured with the DWT cycle counter and read using Os_GetTaskStats. In the preemptive
+ * kernel the execution time of a task excludes the time it was preempted.
+ * It can be given on the compiler command line to build the host kernel test (Os_Kernel_Test.c).
+ */
+#ifndef OS_TASK_STATS_API
+#define OS_TASK_STATS_API                   (STD_OFF)
+#endif
+
+/* Number of bins in the execution time histogram of each task (the last bin collects all the longer runs) */
+#define OS_STATS_HISTOGRAM_BINS             (8U)
+
+/* Width of one histogram bin as a power of 2 in CPU cycles (2^10 = 1024 cycles = 64 us at 16 MHz) */
+#define OS_STATS_HISTOGRAM_SHIFT            (10U)
+
+#endif /* OS_CFG_H_ */
@@ -0,0 +1,119 @@
+;******************************************************************************
+;
+; Module: OS
+;
+; File Name: Os_ContextSwitch.asm
+;
+; Description: Context switching of the Os preemptive kernel (PendSV handler).
+;
+; Author: Bassam Ashraf
+;******************************************************************************
+
+        .thumb
+        .text
+        .align  4
+
+        .global PendSV_Handler
+        .global Os_KernelStart
+
+        .ref    Os_CurrentTcb
+        .ref    Os_NextTcb
+        .ref    Os_ContextSwitchCycles
+        .ref    Os_TaskTerminated
+
+; Os_TcbType layout and the task state values of Os.c
+OS_TCB_STATE_OFFSET         .set    4
+OS_TASK_TERMINATING         .set    2
+
+; Addresses used by the handler (PC relative literals)
+OS_CURRENT_TCB_ADDR:        .word   Os_CurrentTcb
+OS_NEXT_TCB_ADDR:           .word   Os_NextTcb
+OS_SWITCH_CYCLES_ADDR:      .word   Os_ContextSwitchCycles
+DWT_CYCCNT_ADDR:            .word   0xE0001004
+FPU_FPCCR_ADDR:             .word   0xE000EF34
+
+;******************************************************************************
+; PendSV_Handler
+; Saves the context of the running task (R4-R11, EXC_RETURN and S16-S31 when
+; the task used the FPU) on its stack, stores its stack pointer in the first
+; member of its TCB then restores the context of Os_NextTcb.
+; The hardware saves R0-R3, R12, LR, PC and xPSR on the exception entry.
+; A terminating task is not resumed, its context is dropped without writing
+; its TCB and Os_TaskTerminated suspends it (or restarts a pending activation)
+; as its stack is not used any more.
+; The cycles spent in the handler are stored in Os_ContextSwitchCycles[0],
+; the maximum in Os_ContextSwitchCycles[1] and they are added to the sum in
+; Os_ContextSwitchCycles[2] (subtracted from the preempted task statistics).
+;******************************************************************************
+        .thumbfunc PendSV_Handler
+PendSV_Handler: .asmfunc
+        CPSID   I                           ; Os_NextTcb is written by the SysTick interrupt
+        LDR     r12, DWT_CYCCNT_ADDR
+        LDR     r3, [r12]                   ; Cycle counter at the switch start
+
+        LDR     r1, OS_CURRENT_TCB_ADDR
+        LDR     r2, [r1]
+        LDRB    r0, [r2, #OS_TCB_STATE_OFFSET]
+        CMP     r0, #OS_TASK_TERMINATING
+        BEQ     PendSV_Terminated
+
+        MRS     r0, PSP                     ; Stack of the running task
+        TST     lr, #0x10                   ; Extended (FPU) frame ?
+        IT      EQ
+        VSTMDBEQ r0!, {s16-s31}
+        STMDB   r0!, {r4-r11, lr}
+        STR     r0, [r2]                    ; Os_CurrentTcb->Stack_Ptr = PSP
+
+PendSV_Restore:
+        LDR     r2, OS_NEXT_TCB_ADDR
+        LDR     r2, [r2]
+        STR     r2, [r1]                    ; Os_CurrentTcb = Os_NextTcb
+        LDR     r0, [r2]                    ; PSP = Os_NextTcb->Stack_Ptr
+
+        LDMIA   r0!, {r4-r11, lr}
+        TST     lr, #0x10
+        IT      EQ
+        VLDMIAEQ r0!, {s16-s31}
+        MSR     PSP, r0
+
+        LDR     r1, [r12]
+        SUB     r1, r1, r3                  ; Cycles of this switch
+        LDR     r2, OS_SWITCH_CYCLES_ADDR
+        STR     r1, [r2]
+        LDR     r3, [r2, #4]
+        CMP     r1, r3
+        IT      HI
+        STRHI   r1, [r2, #4]
+        LDR     r0, [r2, #8]
+        ADD     r0, r0, r1
+        STR     r0, [r2, #8]                ; Sum of the switch cycles
+
+        CPSIE   I
+        BX      lr
+
+PendSV_Terminated:
+        LDR     r0, FPU_FPCCR_ADDR
+        LDR     r2, [r0]
+        BIC     r2, r2, #1                  ; FPCCR.LSPACT = 0, drop the lazy FPU state reserved on its stack
+        STR     r2, [r0]
+        PUSH    {r1, r3, r12, lr}
+        BL      Os_TaskTerminated           ; May set Os_NextTcb to the restarted task
+        POP     {r1, r3, r12, lr}
+        B       PendSV_Restore
+        .endasmfunc
+
+;******************************************************************************
+; Os_KernelStart(uint32 * IdleStackTop, void (*IdleFunction)(void))
+; Moves the thread mode to the process stack (PSP) of the idle task and jumps
+; to the idle function, it never returns.
+;******************************************************************************
+        .thumbfunc Os_KernelStart
+Os_KernelStart: .asmfunc
+        MSR     PSP, r0
+        MOVS    r2, #2                      ; CONTROL.SPSEL = 1 (thread mode uses PSP)
+        MSR     CONTROL, r2
+        ISB
+        BX      r1
+        .endasmfunc
+
+        .end
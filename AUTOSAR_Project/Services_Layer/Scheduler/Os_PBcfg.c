@@ -0,0 +1,38 @@
+/******************************************************************************
+ *
+ * Module: OS
+ *
+ * File Name: Os_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for Os Scheduler.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "Os.h"
+#include "Application/App.h"
+#include "ECUAL/Button/Button.h"
+#include "Services_Layer/Software_Timer/SwTimer.h"
+#include "Services_Layer/Fault_Log/FaultLog.h"
+
+/* Array of structure that hold the tasks table each structure include:
+ * 1. Pointer to the task function.
+ * 2. The task period in ms (multiple of OS_BASE_TIME), 0 for an event task activated only by Os_ActivateTask.
+ * 3. The task offset (first activation phase) in ms (multiple of OS_BASE_TIME and less than the period).
+ * 4. The task execution time in micro-seconds used by the offset optimizer.
+ * 5. The task priority used by the preemptive kernel (higher value preempts lower value).
+ *
+ * Tasks released in the same tick are dispatched in the order of this table. */
+const Os_TaskConfigType Os_TasksConfigurations[OS_NUMBER_OF_TASKS] =
+{
+#if (BUTTON_EDGE_INTERRUPT_MODE == STD_ON)
+     { Button_Task,  0U, 0U, 12U, 4U },     /* Button Task activated by the SW1 edges and the settle timer */
+     { App_Task,     0U, 0U, 15U, 2U },     /* App Task activated by the button events */
+#else
+     { Button_Task, 20U, 0U, 12U, 4U },     /* Button Task every 20 ms */
+     { App_Task,    60U, 0U, 15U, 2U },     /* App Task every 60 ms    */
+#endif
+     { Led_Task,    40U, 0U, 10U, 3U },     /* Led Task every 40 ms    */
+     { SwTimer_MainFunction, 20U, 0U, 5U, 5U },  /* Software timers every tick */
+     { FaultLog_MainFunction, 20U, 0U, 10U, 1U } /* Fault log write-back every tick, lowest priority background work */
+};
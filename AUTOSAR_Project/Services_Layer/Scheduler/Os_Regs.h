@@ -0,0 +1,23 @@
+ /******************************************************************************
+ *
+ * Module: OS
+ *
+ * File Name: Os_Regs.h
+ *
+ * Description: Header file for the Cortex-M4 core registers used by the Os Scheduler.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef OS_REGS_H_
+#define OS_REGS_H_
+
+#include "Std_Types.h"
+
+/*****************************************************************************
+                        System Control Block Registers
+*****************************************************************************/
+#define NVIC_SYSTEM_INTCTRL_REG   ( *((volatile uint32 *)0xE000ED04) )
+#define NVIC_SYSTEM_PRI3_REG      ( *((volatile uint32 *)0xE000ED20) )
+
+#endif /* OS_REGS_H_ */
@@ -0,0 +1,295 @@
+ /******************************************************************************
+ *
+ * Module: Software Timer
+ *
+ * File Name: SwTimer.c
+ *
+ * Description: Source file for the Software Timer Service.
+ *
+ *              Hashed timer wheel: a running timer is linked in the slot of its expiry tick
+ *              modulo SWTIMER_WHEEL_SIZE (doubly linked lists of timer indexes). Start and stop
+ *              are O(1), a tick only visits the timers of its own slot, the timers expiring in
+ *              a later turn of the wheel are skipped by comparing their expiry tick.
+ *              The expired timers are first moved to the expired list then their actions run,
+ *              so a callback can start or stop any timer while the tick is processed.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "SwTimer.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define SWTIMER_SLOT_MASK                   (SWTIMER_WHEEL_SIZE - 1U)
+
+/* List index of the expired timers waiting for their actions (after the wheel slots) */
+#define SWTIMER_EXPIRED_LIST                (SWTIMER_WHEEL_SIZE)
+
+/* End of a list */
+#define SWTIMER_INVALID_ID                  (SwTimer_IdType)0xFFFF
+
+/* List index of a stopped timer */
+#define SWTIMER_NOT_LINKED                  (0xFFFFU)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Runtime data of one timer */
+typedef struct
+{
+    uint32 Expiry_Tick;
+    uint32 Period_Ticks;
+    SwTimer_IdType Next;
+    SwTimer_IdType Prev;
+    uint16 List;
+}SwTimer_TimerType;
+
+/*******************************************************************************
+ *                  Special Global variable for "SwTimer.c" only               *
+ *******************************************************************************/
+
+static SwTimer_TimerType g_Timers[SWTIMER_NUMBER_OF_TIMERS];
+
+/* First timer of each wheel slot and of the expired list */
+static SwTimer_IdType g_List_Head[SWTIMER_WHEEL_SIZE + 1];
+
+/* The last Os tick processed by SwTimer_MainFunction, it is behind the Os time until the task has run in the tick */
+static uint32 g_Processed_Tick = 0;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void SwTimer_Link(SwTimer_IdType TimerId, uint16 List);
+
+static void SwTimer_Unlink(SwTimer_IdType TimerId);
+
+static void SwTimer_ProcessTick(uint32 Tick);
+
+/*******************************************************************************
+ *                          Function definitions                               *
+ *******************************************************************************/
+
+/* Description: Stop all the timers and start counting from the current Os tick */
+void SwTimer_Init(void)
+{
+    SwTimer_IdType TimerId = 0;
+    uint16 list = 0;
+
+    for(list = 0; list <= SWTIMER_EXPIRED_LIST; list++)
+    {
+        g_List_Head[list] = SWTIMER_INVALID_ID;
+    }
+    for(TimerId = 0; TimerId < SWTIMER_NUMBER_OF_TIMERS; TimerId++)
+    {
+        g_Timers[TimerId].List = SWTIMER_NOT_LINKED;
+    }
+    g_Processed_Tick = Os_GetTickCount();
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Start (or restart) a timer to expire after TimeMs, then every PeriodMs if PeriodMs is not 0 (one-shot).
+ *              The times are rounded up to the Os tick (OS_BASE_TIME). Return E_NOT_OK for an invalid timer.
+ */
+Std_ReturnType SwTimer_Start(SwTimer_IdType TimerId, uint32 TimeMs, uint32 PeriodMs)
+{
+    uint32 ticks = 0;
+    Std_ReturnType ret = E_NOT_OK;
+
+    if(TimerId < SWTIMER_NUMBER_OF_TIMERS)
+    {
+        /* At least one tick after the current Os tick, a timer never expires in the tick it was started in
+           even if SwTimer_MainFunction has not processed the current tick yet */
+        ticks = (TimeMs + OS_BASE_TIME - 1) / OS_BASE_TIME;
+        if(0 == ticks)
+        {
+            ticks = 1;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+
+        SwTimer_Unlink(TimerId);
+        g_Timers[TimerId].Expiry_Tick  = Os_GetTickCount() + ticks;
+        g_Timers[TimerId].Period_Ticks = (PeriodMs + OS_BASE_TIME - 1) / OS_BASE_TIME;
+        SwTimer_Link(TimerId, (uint16)(g_Timers[TimerId].Expiry_Tick & SWTIMER_SLOT_MASK));
+        ret = E_OK;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return ret;
+}
+
+/*********************************************************************************************/
+
+/* Description: Stop a timer, nothing is done if it is not running */
+void SwTimer_Stop(SwTimer_IdType TimerId)
+{
+    if(TimerId < SWTIMER_NUMBER_OF_TIMERS)
+    {
+        SwTimer_Unlink(TimerId);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Return TRUE if the timer is running */
+boolean SwTimer_IsRunning(SwTimer_IdType TimerId)
+{
+    boolean running = FALSE;
+
+    if((TimerId < SWTIMER_NUMBER_OF_TIMERS) && (SWTIMER_NOT_LINKED != g_Timers[TimerId].List))
+    {
+        running = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return running;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Os task executes every Os tick, it processes all the ticks since its last run
+ *              and runs the expiry actions of the timers in the order of their expiry.
+ */
+void SwTimer_MainFunction(void)
+{
+    uint32 current_tick = Os_GetTickCount();
+
+    /* The ticks are processed one by one so no expiry is missed after an overrun or a tickless sleep */
+    while(g_Processed_Tick != current_tick)
+    {
+        g_Processed_Tick++;
+        SwTimer_ProcessTick(g_Processed_Tick);
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Move the expired timers of the tick slot to the expired list then run their actions */
+static void SwTimer_ProcessTick(uint32 Tick)
+{
+    const SwTimer_ConfigType * Config_Ptr = NULL_PTR;
+    SwTimer_IdType TimerId = g_List_Head[Tick & SWTIMER_SLOT_MASK];
+    SwTimer_IdType next = SWTIMER_INVALID_ID;
+
+    while(SWTIMER_INVALID_ID != TimerId)
+    {
+        next = g_Timers[TimerId].Next;
+        if(Tick == g_Timers[TimerId].Expiry_Tick)
+        {
+            SwTimer_Unlink(TimerId);
+            SwTimer_Link(TimerId, SWTIMER_EXPIRED_LIST);
+        }
+        else
+        {
+            /* Expires in a later turn of the wheel */
+        }
+        TimerId = next;
+    }
+
+    /* The list head is read again each time as the actions may start or stop the expired timers */
+    while(SWTIMER_INVALID_ID != g_List_Head[SWTIMER_EXPIRED_LIST])
+    {
+        TimerId = g_List_Head[SWTIMER_EXPIRED_LIST];
+        SwTimer_Unlink(TimerId);
+
+        if(0 != g_Timers[TimerId].Period_Ticks)
+        {
+            /* The next expiry is relative to this one so the periodic timer does not drift */
+            g_Timers[TimerId].Expiry_Tick += g_Timers[TimerId].Period_Ticks;
+            SwTimer_Link(TimerId, (uint16)(g_Timers[TimerId].Expiry_Tick & SWTIMER_SLOT_MASK));
+        }
+        else
+        {
+            /* One-shot timer, it stays stopped */
+        }
+
+        Config_Ptr = &SwTimer_Configurations[TimerId];
+        if(NULL_PTR != Config_Ptr->Callback_Ptr)
+        {
+            Config_Ptr->Callback_Ptr();
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        if(SWTIMER_NO_TASK != Config_Ptr->Task_Id)
+        {
+            (void)Os_ActivateTask(Config_Ptr->Task_Id);
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Add a stopped timer to the head of a list */
+static void SwTimer_Link(SwTimer_IdType TimerId, uint16 List)
+{
+    SwTimer_TimerType * Timer_Ptr = &g_Timers[TimerId];
+
+    Timer_Ptr->List = List;
+    Timer_Ptr->Prev = SWTIMER_INVALID_ID;
+    Timer_Ptr->Next = g_List_Head[List];
+    if(SWTIMER_INVALID_ID != Timer_Ptr->Next)
+    {
+        g_Timers[Timer_Ptr->Next].Prev = TimerId;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    g_List_Head[List] = TimerId;
+}
+
+/*********************************************************************************************/
+
+/* Description: Remove a timer from its list, nothing is done if it is not linked */
+static void SwTimer_Unlink(SwTimer_IdType TimerId)
+{
+    SwTimer_TimerType * Timer_Ptr = &g_Timers[TimerId];
+
+    if(SWTIMER_NOT_LINKED != Timer_Ptr->List)
+    {
+        if(SWTIMER_INVALID_ID != Timer_Ptr->Prev)
+        {
+            g_Timers[Timer_Ptr->Prev].Next = Timer_Ptr->Next;
+        }
+        else
+        {
+            g_List_Head[Timer_Ptr->List] = Timer_Ptr->Next;
+        }
+        if(SWTIMER_INVALID_ID != Timer_Ptr->Next)
+        {
+            g_Timers[Timer_Ptr->Next].Prev = Timer_Ptr->Prev;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Timer_Ptr->List = SWTIMER_NOT_LINKED;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
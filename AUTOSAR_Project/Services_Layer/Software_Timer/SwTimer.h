@@ -0,0 +1,84 @@
+ /******************************************************************************
+ *
+ * Module: Software Timer
+ *
+ * File Name: SwTimer.h
+ *
+ * Description: Header file for the Software Timer Service, one-shot and periodic timers
+ *              driven by the Os tick using a hashed timer wheel.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef SWTIMER_H_
+#define SWTIMER_H_
+
+#include "Std_Types.h"
+
+/* Software Timer Pre-Compile Configuration Header file */
+#include "SwTimer_Cfg.h"
+
+/* The Os task type used for the task activation on expiry */
+#include "Services_Layer/Scheduler/Os.h"
+
+#if ((SWTIMER_WHEEL_SIZE == 0) || ((SWTIMER_WHEEL_SIZE & (SWTIMER_WHEEL_SIZE - 1)) != 0))
+#error "SWTIMER_WHEEL_SIZE must be a power of 2"
+#endif
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Task field value of a timer that calls its callback only */
+#define SWTIMER_NO_TASK                     (Os_TaskType)0xFF
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for SwTimer_IdType used by the Software Timer APIs (index in the timers table) */
+typedef uint16 SwTimer_IdType;
+
+/* Description: Structure to configure the expiry action of each timer:
+ *  1. Callback called on expiry (NULL_PTR for none).
+ *  2. Task activated on expiry using Os_ActivateTask (SWTIMER_NO_TASK for none).
+ */
+typedef struct
+{
+    void (*Callback_Ptr)(void);
+    Os_TaskType Task_Id;
+}SwTimer_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description: Stop all the timers and start counting from the current Os tick */
+void SwTimer_Init(void);
+
+/*
+ * Description: Start (or restart) a timer to expire after TimeMs, then every PeriodMs if PeriodMs is not 0 (one-shot).
+ *              The times are rounded up to the Os tick (OS_BASE_TIME). Return E_NOT_OK for an invalid timer.
+ */
+Std_ReturnType SwTimer_Start(SwTimer_IdType TimerId, uint32 TimeMs, uint32 PeriodMs);
+
+/* Description: Stop a timer, nothing is done if it is not running */
+void SwTimer_Stop(SwTimer_IdType TimerId);
+
+/* Description: Return TRUE if the timer is running */
+boolean SwTimer_IsRunning(SwTimer_IdType TimerId);
+
+/*
+ * Description: Os task executes every Os tick, it processes all the ticks since its last run
+ *              and runs the expiry actions of the timers in the order of their expiry.
+ */
+void SwTimer_MainFunction(void);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by SwTimer */
+extern const SwTimer_ConfigType SwTimer_Configurations[SWTIMER_NUMBER_OF_TIMERS];
+
+#endif /* SWTIMER_H_ */
@@ -0,0 +1,30 @@
+ /******************************************************************************
+ *
+ * Module: Software Timer
+ *
+ * File Name: SwTimer_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Software Timer Service.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef SWTIMER_CFG_H_
+#define SWTIMER_CFG_H_
+
+/* Number of the configured timers in the array of structures in SwTimer_PBcfg.c (up to 65534) */
+#define SWTIMER_NUMBER_OF_TIMERS            (3U)
+
+/*
+ * Number of the slots in the timer wheel, MUST be a power of 2. A timer is placed in the slot of
+ * its expiry tick modulo the wheel size, so the timers expiring within this number of ticks
+ * never share a slot with a later timer.
+ */
+#define SWTIMER_WHEEL_SIZE                  (64U)
+
+/* Timer Index in the array of structures in SwTimer_PBcfg.c */
+#define SwTimerConf_LED_PATTERN_TIMER_ID    (uint16)0x0000
+#define SwTimerConf_BUTTON_SETTLE_TIMER_ID  (uint16)0x0001
+#define SwTimerConf_BUTTON_GESTURE_TIMER_ID (uint16)0x0002
+
+#endif /* SWTIMER_CFG_H_ */
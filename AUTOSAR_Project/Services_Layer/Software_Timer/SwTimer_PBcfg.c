@@ -0,0 +1,25 @@
+/******************************************************************************
+ *
+ * Module: Software Timer
+ *
+ * File Name: SwTimer_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for the Software Timer Service.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "SwTimer.h"
+
+/* Modules of the expiry callbacks */
+#include "ECUAL/Led/Led.h"
+
+/* Array of structure that hold the expiry action of each timer:
+ * 1. Callback called on expiry (NULL_PTR for none).
+ * 2. Task activated on expiry (SWTIMER_NO_TASK for none). */
+const SwTimer_ConfigType SwTimer_Configurations[SWTIMER_NUMBER_OF_TIMERS] =
+{
+     { Led_PatternMainFunction, SWTIMER_NO_TASK }, /* LED pattern tick while a LED plays a pattern */
+     { NULL_PTR, OsConf_BUTTON_TASK_ID },   /* Activate the Button Task at the end of the settle window */
+     { NULL_PTR, OsConf_BUTTON_TASK_ID }    /* Activate the Button Task every tick while a held button waits for a gesture */
+};
@@ -0,0 +1,166 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace.c
+ *
+ * Description: Source file for the Trace Service.
+ *              A frame is built on the stack and queued whole in the UART ring buffer with the
+ *              interrupts suspended (several producers), it is never partly sent. The frames
+ *              dropped on a full buffer are reported by an OVERFLOW frame as soon as there is
+ *              room to resume, so the decoder knows where the stream has a gap.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "Trace.h"
+
+#if (TRACE_ENABLED == STD_ON)
+
+#include "MCAL/GPT/Gpt.h"
+#include "MCAL/UART/Uart.h"
+
+/* Interrupts lock of the producers */
+#include "Services_Layer/Scheduler/Os.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/*
+ * Free bytes needed to resume after a drop, the stream stays stopped until the UART buffer is half empty
+ * so an overload sends long runs of frames with one OVERFLOW frame each instead of one OVERFLOW frame per frame.
+ */
+#define TRACE_RESUME_FREE_BYTES             (UART_TX_BUFFER_SIZE / 2U)
+
+/*******************************************************************************
+ *                  Special Global variable for "Trace.c" only                 *
+ *******************************************************************************/
+
+/* Number of the frames dropped since the start and since the last OVERFLOW frame */
+static uint32 g_Trace_Dropped_Count = 0;
+static uint16 g_Trace_Unreported_Drops = 0;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Trace_WriteHeader(uint8 * Frame_Ptr, uint8 Type, uint32 Timestamp);
+
+static void Trace_SendFrame(uint8 * Frame_Ptr, uint8 Size, uint32 Timestamp);
+
+/*******************************************************************************
+ *                          Function definitions                               *
+ *******************************************************************************/
+
+/*
+ * Description: Queue a DET frame, it never waits: the frame is dropped and counted if the UART
+ *              buffer is full. It can be called from the tasks and the ISRs.
+ */
+void Trace_ReportDet(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId)
+{
+    uint8 frame[TRACE_DET_FRAME_SIZE];
+    uint32 timestamp = (uint32)Gpt_GetTimestamp();
+
+    Trace_WriteHeader(frame, TRACE_FRAME_DET, timestamp);
+    frame[6]  = (uint8)ModuleId;
+    frame[7]  = (uint8)(ModuleId >> 8);
+    frame[8]  = InstanceId;
+    frame[9]  = ApiId;
+    frame[10] = ErrorId;
+    Trace_SendFrame(frame, TRACE_DET_FRAME_SIZE, timestamp);
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Queue an EVENT frame, it never waits: the frame is dropped and counted if the UART
+ *              buffer is full. It can be called from the tasks and the ISRs.
+ */
+void Trace_ReportEvent(uint8 EventId, uint16 Value)
+{
+    uint8 frame[TRACE_EVENT_FRAME_SIZE];
+    uint32 timestamp = (uint32)Gpt_GetTimestamp();
+
+    Trace_WriteHeader(frame, TRACE_FRAME_EVENT, timestamp);
+    frame[6] = EventId;
+    frame[7] = (uint8)Value;
+    frame[8] = (uint8)(Value >> 8);
+    Trace_SendFrame(frame, TRACE_EVENT_FRAME_SIZE, timestamp);
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the number of the frames dropped since the start */
+uint32 Trace_GetDroppedCount(void)
+{
+    return g_Trace_Dropped_Count;
+}
+
+/*********************************************************************************************/
+
+/* Description: Write the sync byte, the type and the timestamp of a frame */
+static void Trace_WriteHeader(uint8 * Frame_Ptr, uint8 Type, uint32 Timestamp)
+{
+    Frame_Ptr[0] = TRACE_SYNC_BYTE;
+    Frame_Ptr[1] = Type;
+    Frame_Ptr[2] = (uint8)Timestamp;
+    Frame_Ptr[3] = (uint8)(Timestamp >> 8);
+    Frame_Ptr[4] = (uint8)(Timestamp >> 16);
+    Frame_Ptr[5] = (uint8)(Timestamp >> 24);
+}
+
+/*********************************************************************************************/
+
+/* Description: Add the checksum and queue the frame, preceded by an OVERFLOW frame if frames were dropped */
+static void Trace_SendFrame(uint8 * Frame_Ptr, uint8 Size, uint32 Timestamp)
+{
+    uint8 overflow[TRACE_OVERFLOW_FRAME_SIZE];
+    uint8 checksum = 0;
+    uint8 index = 0;
+
+    for(index = 1; index < (Size - 1U); index++)
+    {
+        checksum += Frame_Ptr[index];
+    }
+    Frame_Ptr[Size - 1U] = (uint8)(0U - checksum);
+
+    Os_SuspendAllInterrupts();
+
+    if((0 != g_Trace_Unreported_Drops) && (Uart_GetTxFree() >= TRACE_RESUME_FREE_BYTES))
+    {
+        Trace_WriteHeader(overflow, TRACE_FRAME_OVERFLOW, Timestamp);
+        overflow[6] = (uint8)g_Trace_Unreported_Drops;
+        overflow[7] = (uint8)(g_Trace_Unreported_Drops >> 8);
+        overflow[8] = (uint8)(0U - (uint8)(TRACE_FRAME_OVERFLOW + overflow[2] + overflow[3] + overflow[4]
+                                           + overflow[5] + overflow[6] + overflow[7]));
+        (void)Uart_Transmit(overflow, TRACE_OVERFLOW_FRAME_SIZE);
+        g_Trace_Unreported_Drops = 0;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    if((0 == g_Trace_Unreported_Drops) && (E_OK == Uart_Transmit(Frame_Ptr, Size)))
+    {
+        /* Queued */
+    }
+    else
+    {
+        /* A frame is never queued before the OVERFLOW frame of the earlier drops */
+        g_Trace_Dropped_Count++;
+        if(g_Trace_Unreported_Drops < 0xFFFFU)
+        {
+            g_Trace_Unreported_Drops++;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+
+    Os_ResumeAllInterrupts();
+}
+
+#endif /* TRACE_ENABLED */
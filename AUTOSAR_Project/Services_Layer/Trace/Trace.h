@@ -0,0 +1,73 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace.h
+ *
+ * Description: Header file for the Trace Service, it streams the Det errors and the trace events
+ *              over UART0 as compact binary frames (IDs, no strings) decoded on the host by
+ *              Simulation/Trace_Decode.c.
+ *
+ *              Frame: 0xA5, type, payload, checksum (the sum of the type, payload and checksum bytes is 0).
+ *              All the multi-byte fields are little endian, the timestamp is the low 32 bits of
+ *              Gpt_GetTimestamp (CPU cycles).
+ *                DET      (0x01): timestamp(4) module(2) instance(1) api(1) error(1)   - 12 bytes
+ *                EVENT    (0x02): timestamp(4) event(1) value(2)                       - 10 bytes
+ *                OVERFLOW (0x03): timestamp(4) dropped frames(2)                       -  9 bytes
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include "Std_Types.h"
+
+/* Trace Pre-Compile Configuration Header file */
+#include "Trace_Cfg.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define TRACE_SYNC_BYTE                     (0xA5U)
+
+/* Frame types */
+#define TRACE_FRAME_DET                     (0x01U)
+#define TRACE_FRAME_EVENT                   (0x02U)
+#define TRACE_FRAME_OVERFLOW                (0x03U)
+
+/* Frame sizes including the sync and checksum bytes */
+#define TRACE_DET_FRAME_SIZE                (12U)
+#define TRACE_EVENT_FRAME_SIZE              (10U)
+#define TRACE_OVERFLOW_FRAME_SIZE           (9U)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+#if (TRACE_ENABLED == STD_ON)
+
+/*
+ * Description: Queue a DET frame, it never waits: the frame is dropped and counted if the UART
+ *              buffer is full. It can be called from the tasks and the ISRs.
+ */
+void Trace_ReportDet(uint16 ModuleId, uint8 InstanceId, uint8 ApiId, uint8 ErrorId);
+
+/*
+ * Description: Queue an EVENT frame, it never waits: the frame is dropped and counted if the UART
+ *              buffer is full. It can be called from the tasks and the ISRs.
+ */
+void Trace_ReportEvent(uint8 EventId, uint16 Value);
+
+/* Description: Return the number of the frames dropped since the start */
+uint32 Trace_GetDroppedCount(void);
+
+#else
+
+#define Trace_ReportDet(ModuleId, InstanceId, ApiId, ErrorId)
+#define Trace_ReportEvent(EventId, Value)
+
+#endif
+
+#endif /* TRACE_H_ */
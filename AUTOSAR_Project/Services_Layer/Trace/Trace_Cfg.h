@@ -0,0 +1,21 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for the Trace Service.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef TRACE_CFG_H_
+#define TRACE_CFG_H_
+
+/* Pre-compile option to stream the Det errors and the trace events over UART0 */
+#define TRACE_ENABLED                       (STD_ON)
+
+/* Event IDs of Trace_ReportEvent, the host decoder prints them by name (Simulation/Trace_Decode.c) */
+#define TraceConf_OS_OVERRUN_EVENT_ID       (uint8)0x01     /* Value: number of the late ticks */
+
+#endif /* TRACE_CFG_H_ */
@@ -0,0 +1,29 @@
+ /******************************************************************************
+ *
+ * Module: Trace
+ *
+ * File Name: Trace_Hooks.h
+ *
+ * Description: Hooks of the other services mapped to the Trace Service, it is included by the
+ *              source files that call the hooks (Det.c and Os.c) so their configuration headers
+ *              do not depend on the Trace Service.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef TRACE_HOOKS_H_
+#define TRACE_HOOKS_H_
+
+#include "Trace.h"
+
+/* Det hook called for each report that passes the rate limit, after the interrupts are resumed, it streams the error over UART0 */
+#define DET_ERROR_HOOK(ModuleId, InstanceId, ApiId, ErrorId)   Trace_ReportDet(ModuleId, InstanceId, ApiId, ErrorId)
+
+/*
+ * Os hook called by the scheduler with the number of the late ticks (arrived while the previous ticks were
+ * pending) when an overrun is detected, it is called from the scheduler context (not the interrupt) before
+ * the pending ticks are processed. The late ticks are then caught up or dropped by OS_OVERRUN_POLICY.
+ */
+#define OS_OVERRUN_HOOK(LateTicks)          Trace_ReportEvent(TraceConf_OS_OVERRUN_EVENT_ID, (uint16)(LateTicks))
+
+#endif /* TRACE_HOOKS_H_ */
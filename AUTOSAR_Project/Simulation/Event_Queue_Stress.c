@@ -0,0 +1,184 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Event_Queue_Stress.c
+ *
+ * Description: Host stress test of the Event Queue Service with a producer thread and a consumer
+ *              thread on the same queue. The producer pushes a numbered sequence of events and
+ *              retries when the queue is full, the consumer checks that it pops every number once
+ *              and in order and that the three fields of each event belong to the same number
+ *              (no event read before it was complete). The host barriers of MEMORY_BARRIER
+ *              (Compiler.h) stand for the DMB of the target.
+ *
+ *              Build and run (from the AUTOSAR_Project folder):
+ *                gcc -std=c99 -O2 -DHOST_SIM -pthread -I. -o event_queue_stress
+ *                    Simulation/Event_Queue_Stress.c Services_Layer/Event_Queue/Event_Queue.c
+ *                ./event_queue_stress [events]
+ *
+ *              The exit code is 1 if an event was lost, duplicated, reordered or torn.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "Services_Layer/Event_Queue/Event_Queue.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Queue under test */
+#define STRESS_QUEUE_ID                 EventQueueConf_BUTTON_EVENTS_QUEUE_ID
+
+/* Default number of the events when no number is given */
+#define STRESS_DEFAULT_EVENTS           (20000000UL)
+
+/* Pattern mixed into the data of each event to detect a torn event */
+#define STRESS_DATA_PATTERN             (0xA5A5A5A5UL)
+
+/* Highest number of the failures printed */
+#define STRESS_MAX_PRINTED_FAILURES     (10U)
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+static uint32 g_Stress_Events = STRESS_DEFAULT_EVENTS;
+
+/* Pushes refused because the queue was full, counted by the producer */
+static uint32 g_Stress_Full_Pushes = 0;
+
+/* Events popped with an unexpected number (lost, duplicated or reordered) or torn fields */
+static uint32 g_Stress_Sequence_Errors = 0;
+static uint32 g_Stress_Torn_Events = 0;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: Push the events 0 to g_Stress_Events - 1 in order, a refused push is retried */
+static void * Stress_Producer(void * Arg)
+{
+    EventQueue_EventType event;
+    uint32 number = 0;
+
+    (void)Arg;
+    while(number < g_Stress_Events)
+    {
+        event.Event_Id = (uint16)(number & 0xFFFFU);
+        event.Param    = (uint16)(number >> 16);
+        event.Data     = number ^ STRESS_DATA_PATTERN;
+        if(E_OK == EventQueue_Push(STRESS_QUEUE_ID, &event))
+        {
+            number++;
+        }
+        else
+        {
+            g_Stress_Full_Pushes++;
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/* Description: Pop the events and check that each number comes once and in order */
+static void * Stress_Consumer(void * Arg)
+{
+    EventQueue_EventType event;
+    uint32 expected = 0;
+    uint32 number = 0;
+
+    (void)Arg;
+    while(expected < g_Stress_Events)
+    {
+        if(E_OK == EventQueue_Pop(STRESS_QUEUE_ID, &event))
+        {
+            number = ((uint32)event.Param << 16) | event.Event_Id;
+            if((event.Data ^ STRESS_DATA_PATTERN) != number)
+            {
+                if(g_Stress_Torn_Events < STRESS_MAX_PRINTED_FAILURES)
+                {
+                    printf("Torn event %lu: Event_Id 0x%04X Param 0x%04X Data 0x%08lX\n", (unsigned long)expected,
+                           event.Event_Id, event.Param, (unsigned long)event.Data);
+                }
+                g_Stress_Torn_Events++;
+            }
+            else if(number != expected)
+            {
+                if(g_Stress_Sequence_Errors < STRESS_MAX_PRINTED_FAILURES)
+                {
+                    printf("Event %lu popped instead of %lu\n", (unsigned long)number, (unsigned long)expected);
+                }
+                g_Stress_Sequence_Errors++;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+
+            /* Continue after the popped number so one error is not reported for every following event */
+            expected = number + 1;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char * argv[])
+{
+    pthread_t producer;
+    pthread_t consumer;
+    uint32 failed = 0;
+
+    if(argc > 1)
+    {
+        g_Stress_Events = (uint32)strtoul(argv[1], NULL, 10);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    if((0 != pthread_create(&consumer, NULL, Stress_Consumer, NULL))
+       || (0 != pthread_create(&producer, NULL, Stress_Producer, NULL)))
+    {
+        printf("The threads can not be created\n");
+        return 2;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    (void)pthread_join(producer, NULL);
+    (void)pthread_join(consumer, NULL);
+
+    /* Every refused push is an overflow and the queue is left empty */
+    failed = g_Stress_Sequence_Errors + g_Stress_Torn_Events;
+    if((EventQueue_GetOverflowCount(STRESS_QUEUE_ID) != g_Stress_Full_Pushes) || (0 != EventQueue_GetCount(STRESS_QUEUE_ID)))
+    {
+        printf("Overflow count %lu for %lu refused pushes, %lu events left\n",
+               (unsigned long)EventQueue_GetOverflowCount(STRESS_QUEUE_ID), (unsigned long)g_Stress_Full_Pushes,
+               (unsigned long)EventQueue_GetCount(STRESS_QUEUE_ID));
+        failed++;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    printf("Events             : %lu (%lu pushes refused on a full queue)\n",
+           (unsigned long)g_Stress_Events, (unsigned long)g_Stress_Full_Pushes);
+    printf("Sequence errors    : %lu\n", (unsigned long)g_Stress_Sequence_Errors);
+    printf("Torn events        : %lu\n", (unsigned long)g_Stress_Torn_Events);
+    return (0 == failed) ? 0 : 1;
+}
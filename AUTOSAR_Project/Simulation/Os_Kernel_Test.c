@@ -0,0 +1,379 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Os_Kernel_Test.c
+ *
+ * Description: Host test of the task termination in the preemptive kernel. The kernel source
+ *              is included to reach its private state, PendSV_Handler is replaced by a C model
+ *              of Os_ContextSwitch.asm and the task code is not executed: the test switches to
+ *              a task, fills its stack as the live stack of the running code, terminates it and
+ *              releases it (SysTick or Os_ActivateTask) before the PendSV model switches away.
+ *              The System Control Block page is mapped at its target address so the kernel
+ *              writes the PendSV request to NVIC_SYSTEM_INTCTRL_REG unchanged.
+ *              The execution time statistics are checked on nested task runs of a test clock,
+ *              the task stand-ins model the preemptions and their context switches.
+ *
+ *              Build and run (from the AUTOSAR_Project folder):
+ *                gcc -std=c99 -O2 -DHOST_SIM -DOS_PREEMPTIVE_KERNEL=STD_ON -DOS_TASK_STATS_API=STD_ON
+ *                    -Wno-pointer-to-int-cast -I.
+ *                    -o os_kernel_test Simulation/Os_Kernel_Test.c Services_Layer/Scheduler/Os_PBcfg.c
+ *                ./os_kernel_test
+ *
+ *              The exit code is 1 if a check failed.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/* Allow the preemptive kernel in the host build, PendSV_Handler is modeled by Test_PendSV */
+#define OS_KERNEL_TEST
+
+#include "Services_Layer/Scheduler/Os.c"
+
+#if (OS_PREEMPTIVE_KERNEL == STD_OFF) || (OS_TASK_STATS_API == STD_OFF)
+#error "Build the kernel test with -DOS_PREEMPTIVE_KERNEL=STD_ON -DOS_TASK_STATS_API=STD_ON"
+#endif
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* System Control Block page holding NVIC_SYSTEM_INTCTRL_REG and NVIC_SYSTEM_PRI3_REG */
+#define TEST_SCB_PAGE_ADDRESS           (0xE000E000UL)
+#define TEST_SCB_PAGE_SIZE              (0x1000UL)
+
+/* Words of the frames built by Os_PrepareTaskStack: R4-R11, EXC_RETURN, R0-R3, R12, LR, PC, xPSR */
+#define TEST_FRAME_WORDS                (17U)
+#define TEST_FRAME_EXC_RETURN           (8U)
+#define TEST_FRAME_R0                   (9U)
+#define TEST_FRAME_XPSR                 (16U)
+
+/* Content of the live stack of the running task */
+#define TEST_LIVE_STACK_BYTE            (0xA5U)
+
+/* Highest number of ticks to reach a task release */
+#define TEST_MAX_TICKS                  (100U)
+
+/* Cycles of a task run and of a context switch of the test clock */
+#define TEST_TASK_CYCLES                (1000U)
+#define TEST_SWITCH_CYCLES              (40U)
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* Process stack pointer of the running task, stored in its TCB by the PendSV model */
+static uint32 * g_Test_Psp = NULL_PTR;
+
+static uint32 g_Test_Passed = 0;
+static uint32 g_Test_Failed = 0;
+
+/* Test clock returned by Dwt_GetCycleCount */
+static uint32 g_Test_Cycles = 0;
+
+/* Flag set to preempt the task stand-ins in the middle of their run */
+static boolean g_Test_Preempt = FALSE;
+
+static void Test_TaskRun(Os_TaskType PreemptingTask);
+
+/*******************************************************************************
+ *                    Stand-ins of the modules used by the kernel              *
+ *******************************************************************************/
+
+/* The LED task is preempted by the button task and the button task by the fault log task */
+void Init_Task(void) {}
+void Button_Task(void) { Test_TaskRun(OsConf_FAULTLOG_TASK_ID); }
+void Led_Task(void) { Test_TaskRun(OsConf_BUTTON_TASK_ID); }
+void App_Task(void) {}
+void SwTimer_MainFunction(void) {}
+void FaultLog_MainFunction(void) { Test_TaskRun(OS_NUMBER_OF_TASKS); }
+
+void Sim_PostTaskHook(uint8 TaskID) { (void)TaskID; }
+uint32 Sim_GetCycleCount(void) { return g_Test_Cycles; }
+void Dwt_CycleCounterInit(void) {}
+void SysTick_Init(uint16 a_TimeInMilliSeconds) { (void)a_TimeInMilliSeconds; }
+void SysTick_SetCallBack(void (*Ptr2Func)(void)) { (void)Ptr2Func; }
+
+/* Description: The idle task is not run, the test is the thread code */
+void Os_KernelStart(uint32 * IdleStackTop, void (*IdleFunction)(void))
+{
+    (void)IdleFunction;
+    g_Test_Psp = IdleStackTop;
+}
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: Count a check and print it if it failed */
+static void Test_Check(boolean Condition, const char * Text)
+{
+    if(TRUE == Condition)
+    {
+        g_Test_Passed++;
+    }
+    else
+    {
+        g_Test_Failed++;
+        printf("FAILED: %s (tick %u)\n", Text, (unsigned int)g_Time_Tick_Count);
+    }
+}
+
+/*
+ * Description: C model of PendSV_Handler (Os_ContextSwitch.asm), run when the kernel pended it:
+ *              save the PSP of the running task in its TCB or drop the context of a terminating
+ *              task, then restore the stack of Os_NextTcb.
+ */
+static void Test_PendSV(void)
+{
+    Os_TcbType * Tcb_Ptr = (Os_TcbType *)Os_CurrentTcb;
+
+    NVIC_SYSTEM_INTCTRL_REG &= ~OS_PENDSV_SET_MASK;
+    if(OS_TASK_TERMINATING == Tcb_Ptr->State)
+    {
+        Os_TaskTerminated();
+    }
+    else
+    {
+        Tcb_Ptr->Stack_Ptr = g_Test_Psp;
+    }
+    Os_CurrentTcb = Os_NextTcb;
+    g_Test_Psp = ((Os_TcbType *)Os_CurrentTcb)->Stack_Ptr + TEST_FRAME_WORDS;
+}
+
+/*
+ * Description: Run of a task stand-in for TEST_TASK_CYCLES, when g_Test_Preempt is set the required task
+ *              (OS_NUMBER_OF_TASKS for none) preempts it in the middle as PendSV_Handler would switch to it
+ *              and back, the switch cycles are added to the sum of PendSV_Handler.
+ */
+static void Test_TaskRun(Os_TaskType PreemptingTask)
+{
+    g_Test_Cycles += TEST_TASK_CYCLES / 2;
+    if((TRUE == g_Test_Preempt) && (PreemptingTask < OS_NUMBER_OF_TASKS))
+    {
+        g_Test_Cycles += TEST_SWITCH_CYCLES;
+        Os_ContextSwitchCycles[2] += TEST_SWITCH_CYCLES;
+        Os_DispatchTask(PreemptingTask);
+        g_Test_Cycles += TEST_SWITCH_CYCLES;
+        Os_ContextSwitchCycles[2] += TEST_SWITCH_CYCLES;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    g_Test_Cycles += TEST_TASK_CYCLES / 2;
+}
+
+/* Description: Take the pended context switch, PendSV has the lowest priority so it runs after the interrupts */
+static void Test_TakePendSV(void)
+{
+    while(0 != (NVIC_SYSTEM_INTCTRL_REG & OS_PENDSV_SET_MASK))
+    {
+        Test_PendSV();
+    }
+}
+
+/* Description: Return the ID of the running task, OS_NUMBER_OF_TASKS for the idle task */
+static Os_TaskType Test_RunningTask(void)
+{
+    Os_TaskType TaskID = 0;
+
+    while((TaskID < OS_NUMBER_OF_TASKS) && (Os_CurrentTcb != &g_Task_Tcb[TaskID]))
+    {
+        TaskID++;
+    }
+    return TaskID;
+}
+
+/* Description: Return TRUE if every byte of the task stack still holds the live stack content */
+static boolean Test_LiveStackIntact(Os_TaskType TaskID)
+{
+    const uint8 * Byte_Ptr = (const uint8 *)&g_Task_Stack[TaskID][0];
+    uint32 byte = 0;
+    boolean intact = TRUE;
+
+    for(byte = 0; byte < OS_TASK_STACK_SIZE; byte++)
+    {
+        if(TEST_LIVE_STACK_BYTE != Byte_Ptr[byte])
+        {
+            intact = FALSE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return intact;
+}
+
+/* Description: Return TRUE if the task stack holds the initial frame of a new activation */
+static boolean Test_FreshActivation(Os_TaskType TaskID)
+{
+    uint32 * Frame_Ptr = (uint32 *)&g_Task_Stack[TaskID][OS_TASK_STACK_SIZE / 8] - TEST_FRAME_WORDS;
+
+    return (boolean)((g_Task_Tcb[TaskID].Stack_Ptr == Frame_Ptr)
+                     && (OS_INITIAL_EXC_RETURN == Frame_Ptr[TEST_FRAME_EXC_RETURN])
+                     && (TaskID == Frame_Ptr[TEST_FRAME_R0])
+                     && (OS_INITIAL_XPSR == Frame_Ptr[TEST_FRAME_XPSR]));
+}
+
+/*
+ * Description: Advance the time and complete the other tasks until the required task runs, its
+ *              stack is then filled as the live stack of its code. Return FALSE on a timeout.
+ */
+static boolean Test_RunUntil(Os_TaskType TaskID)
+{
+    uint32 ticks = 0;
+    Os_TaskType running = 0;
+
+    Test_TakePendSV();
+    running = Test_RunningTask();
+    while((running != TaskID) && (ticks < TEST_MAX_TICKS))
+    {
+        if(running < OS_NUMBER_OF_TASKS)
+        {
+            Os_TerminateTask(running);
+        }
+        else
+        {
+            Os_NewTimerTick();
+            ticks++;
+        }
+        Test_TakePendSV();
+        running = Test_RunningTask();
+    }
+
+    memset(&g_Task_Stack[TaskID][0], TEST_LIVE_STACK_BYTE, OS_TASK_STACK_SIZE);
+    return (boolean)(running == TaskID);
+}
+
+/* Description: A SysTick release between the termination of the task and PendSV_Handler */
+static void Test_ReleaseWhileTerminating(Os_TaskType TaskID)
+{
+    uint32 misses = 0;
+    uint32 release = 0;
+
+    Test_Check(Test_RunUntil(TaskID), "task runs");
+    Os_TerminateTask(TaskID);
+    misses = g_Task_Deadline_Misses[TaskID];
+    Test_Check((boolean)(OS_TASK_TERMINATING == g_Task_Tcb[TaskID].State), "terminated task is TERMINATING");
+
+    /* The SysTick interrupts preempt the pended switch until the next release of the task */
+    release = g_Task_Next_Release[TaskID];
+    while((sint32)(g_Time_Tick_Count - release) < 0)
+    {
+        Os_NewTimerTick();
+    }
+    Test_Check((boolean)(TRUE == g_Task_Tcb[TaskID].Activation_Pending), "release of a terminating task is pending");
+    Test_Check((boolean)(OS_TASK_TERMINATING == g_Task_Tcb[TaskID].State), "released task stays TERMINATING");
+    Test_Check(Test_LiveStackIntact(TaskID), "live stack is not rebuilt by the release");
+    Test_Check((boolean)(0 == (g_Ready_Bitmap & (1UL << Os_TasksConfigurations[TaskID].Priority))), "terminating task is not ready");
+    Test_Check((boolean)(E_NOT_OK == Os_ActivateTask(TaskID)), "second activation is refused");
+
+    Test_TakePendSV();
+    Test_Check((boolean)(OS_TASK_ACTIVE == g_Task_Tcb[TaskID].State), "pending release starts after PendSV");
+    Test_Check((boolean)(FALSE == g_Task_Tcb[TaskID].Activation_Pending), "pending release is consumed");
+    Test_Check(Test_FreshActivation(TaskID), "PendSV keeps the new stack frame");
+    Test_Check((boolean)(release == g_Task_Activation_Release[TaskID]), "activation keeps its release tick");
+    Test_Check((boolean)(misses == g_Task_Deadline_Misses[TaskID]), "release of a terminating task is no deadline miss");
+    Test_Check((boolean)(Os_CurrentTcb == g_Priority_Tcb[31 - OS_COUNT_LEADING_ZEROS(g_Ready_Bitmap)]), "highest ready task runs");
+}
+
+/* Description: An Os_ActivateTask call from an interrupt between the termination of the task and PendSV_Handler */
+static void Test_ActivateWhileTerminating(Os_TaskType TaskID)
+{
+    Test_Check(Test_RunUntil(TaskID), "task runs");
+    Os_TerminateTask(TaskID);
+
+    Test_Check((boolean)(E_OK == Os_ActivateTask(TaskID)), "activation of a terminating task is accepted");
+    Test_Check((boolean)(E_NOT_OK == Os_ActivateTask(TaskID)), "second activation is refused");
+    Test_Check(Test_LiveStackIntact(TaskID), "live stack is not rebuilt by the activation");
+
+    Test_TakePendSV();
+    Test_Check((boolean)(OS_TASK_ACTIVE == g_Task_Tcb[TaskID].State), "pending activation starts after PendSV");
+    Test_Check(Test_FreshActivation(TaskID), "PendSV keeps the new stack frame");
+    Test_Check((boolean)(g_Time_Tick_Count == g_Task_Activation_Release[TaskID]), "activation keeps its tick");
+}
+
+/* Description: Return TRUE if the only measured run of the task took TEST_TASK_CYCLES */
+static boolean Test_RunMeasured(Os_TaskType TaskID)
+{
+    Os_TaskStatsType Stats;
+
+    return (boolean)((E_OK == Os_GetTaskStats(TaskID, &Stats)) && (1U == Stats.Activations)
+                     && (TEST_TASK_CYCLES == Stats.Execution_Min) && (TEST_TASK_CYCLES == Stats.Execution_Max));
+}
+
+/*
+ * Description: Nested preemptions (the LED task by the button task by the fault log task), the execution
+ *              time of every task excludes the runs of the tasks that preempted it and the context switches.
+ *              The counters start near the wrap around to check the unsigned subtractions.
+ */
+static void Test_PreemptedExecutionTime(void)
+{
+    Os_ResetTaskStats();
+    g_Test_Cycles = 0xFFFFF000UL;
+    Os_ContextSwitchCycles[2] = 0xFFFFFFC0UL;
+    g_Executed_Cycles = 0xFFFFFC00UL;
+    g_Test_Preempt = TRUE;
+
+    Os_DispatchTask(OsConf_LED_TASK_ID);
+    Test_Check(Test_RunMeasured(OsConf_FAULTLOG_TASK_ID), "run without preemption is measured");
+    Test_Check(Test_RunMeasured(OsConf_BUTTON_TASK_ID), "preemption is not measured in the preempted task");
+    Test_Check(Test_RunMeasured(OsConf_LED_TASK_ID), "nested preemptions are not measured in the preempted task");
+    Test_Check((boolean)((3U * TEST_TASK_CYCLES) == (uint32)(g_Executed_Cycles - 0xFFFFFC00UL)), "every run is added once to the executed cycles");
+
+    g_Test_Preempt = FALSE;
+}
+
+/* Description: A termination without a release suspends the task without writing its TCB */
+static void Test_TerminateWithoutRelease(Os_TaskType TaskID)
+{
+    uint32 * Stack_Ptr = NULL_PTR;
+
+    Test_Check(Test_RunUntil(TaskID), "task runs");
+    Stack_Ptr = g_Task_Tcb[TaskID].Stack_Ptr;
+    Os_TerminateTask(TaskID);
+
+    Test_TakePendSV();
+    Test_Check((boolean)(OS_TASK_SUSPENDED == g_Task_Tcb[TaskID].State), "terminated task is suspended by PendSV");
+    Test_Check((boolean)(Stack_Ptr == g_Task_Tcb[TaskID].Stack_Ptr), "PendSV does not save a terminated context");
+    Test_Check((boolean)(Os_CurrentTcb != &g_Task_Tcb[TaskID]), "PendSV switches away from the terminated task");
+}
+
+int main(void)
+{
+    void * Page_Ptr = mmap((void *)TEST_SCB_PAGE_ADDRESS, TEST_SCB_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if(Page_Ptr != (void *)TEST_SCB_PAGE_ADDRESS)
+    {
+        printf("The System Control Block page can not be mapped at 0x%lX\n", TEST_SCB_PAGE_ADDRESS);
+        return 2;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    /* Os_Scheduler builds the idle task and calls Os_KernelStart, then the idle task starts the kernel */
+    Os_InitTasks();
+    Os_Scheduler();
+    g_Kernel_Started = TRUE;
+
+    Test_ReleaseWhileTerminating(OsConf_LED_TASK_ID);
+    Test_ReleaseWhileTerminating(OsConf_FAULTLOG_TASK_ID);
+    Test_ActivateWhileTerminating(OsConf_LED_TASK_ID);
+    Test_TerminateWithoutRelease(OsConf_SWTIMER_TASK_ID);
+    Test_ReleaseWhileTerminating(OsConf_SWTIMER_TASK_ID);
+    Test_PreemptedExecutionTime();
+
+    printf("Os kernel test : %u passed, %u failed\n", (unsigned int)g_Test_Passed, (unsigned int)g_Test_Failed);
+    return (0 == g_Test_Failed) ? 0 : 1;
+}
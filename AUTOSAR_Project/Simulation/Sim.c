@@ -0,0 +1,780 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim.c
+ *
+ * Description: Host simulation of the Os Scheduler, the Application and the ECUAL modules.
+ *              The SysTick interrupt is driven by a virtual clock that jumps to the next
+ *              interrupt whenever the scheduler is idle, so the simulated time runs as fast
+ *              as the host can execute the tasks. SW1 is driven from a scripted input trace,
+ *              the idle jumps also stop at the trace events so an input edge interrupt runs at
+ *              the time of the edge. The report gives the delay from each SW1 press to the LED1
+ *              change it causes, build with -DBUTTON_EDGE_INTERRUPT_MODE=STD_ON to measure the
+ *              edge interrupt mode of the Button Module.
+ *
+ *              Build (from the AUTOSAR_Project folder):
+ *                gcc -std=c99 -O2 -DHOST_SIM -I. -o os_sim Simulation/Sim.c Simulation/Sim_Gpt.c
+ *                    Simulation/Sim_Dio.c Simulation/Sim_Mcu.c Simulation/Sim_Port.c Simulation/Sim_Irq.c
+ *                    Simulation/Sim_Eep.c Simulation/Sim_Uart.c Simulation/Sim_Icu.c Simulation/Sim_Pwm.c
+ *                    Application/App.c ECUAL/Button/Button.c ECUAL/Button/Button_PBcfg.c ECUAL/Led/Led.c
+ *                    ECUAL/Led/Led_PBcfg.c Services_Layer/Scheduler/Os.c Services_Layer/Scheduler/Os_PBcfg.c
+ *                    Services_Layer/Development_Error_Tracer/Det.c Services_Layer/Software_Timer/SwTimer.c
+ *                    Services_Layer/Software_Timer/SwTimer_PBcfg.c Services_Layer/Fault_Log/FaultLog.c
+ *                    Services_Layer/Trace/Trace.c Services_Layer/Event_Queue/Event_Queue.c MCAL/Dio/Dio_PBcfg.c
+ *                    MCAL/Port/Port_PBcfg.c MCAL/ICU/Icu_PBcfg.c MCAL/PWM/Pwm_PBcfg.c
+ *
+ *              Run:
+ *                ./os_sim [-t trace_file] [-h simulated_hours | -n ticks] [-u uart_capture_file]
+ *
+ *              The UART0 trace stream is written to the capture file, decode it with:
+ *                gcc -std=c99 -O2 -DHOST_SIM -I. -o trace_decode Simulation/Trace_Decode.c
+ *                ./trace_decode uart_capture_file
+ *
+ *              Trace file, one event per line (times in ms from the start of the trace loop):
+ *                <time> SW1 <0|1>            Drive the SW1 input level (0 = pressed).
+ *                <time> LOAD <task id> <ms>  The next run of the task takes <ms> of execution time.
+ *                <time> EXPECT LEDn <0|1>    Check the level of LED1, LED2 or LED3, before the tasks of that tick run.
+ *                <time> GLITCH LEDn          Flip the LED pin without the Led Module, the refresh corrects it.
+ *                <time> COUNT <counter> [<index>] <n>  Check that the counter increased by n since the start of the
+ *                                            trace loop: LATE_TICKS, LOST_TICKS, MISSES <task id>, DET_REPORTED,
+ *                                            DET_RECORDED (passed the rate limit), DET_SUPPRESSED (rate limited),
+ *                                            BUTTON_PRESSED, BUTTON_RELEASED, BUTTON_LONG_PRESS, BUTTON_DOUBLE_CLICK,
+ *                                            BUTTON_REPEAT (events of the gesture engine, no index with one button).
+ *                <time> DET <module> <api> <error>  Report a development error to the Det.
+ *                <time> DET_STATS <module> <api> <error> <n>  Check that the occurrences of the error in the
+ *                                            Det statistics increased by n since the start of the trace loop.
+ *                <time> FAULTLOG <age> <module> <api> <error>  Check the stored error of the age in the fault log
+ *                                            (0 is the newest), FAULTLOG <age> NONE checks that there is none.
+ *                <time> FAULTLOG_RESET       Run Eep_Init and FaultLog_Init again like a reset, a running EEPROM
+ *                                            write job is interrupted and the errors not written are lost.
+ *                <time> REPEAT               Restart the trace from its first event.
+ *              Lines starting with '#' are comments. The exit code is 1 if an EXPECT failed.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Sim.h"
+#include "Services_Layer/Scheduler/Os.h"
+#include "MCAL/Dio/Dio.h"
+#include "ECUAL/Led/Led.h"
+#include "ECUAL/Button/Button.h"
+#include "Services_Layer/Development_Error_Tracer/Det.h"
+#include "Services_Layer/Fault_Log/FaultLog.h"
+#include "Services_Layer/Trace/Trace.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Trace event types */
+#define SIM_EVENT_SW1                   (0U)
+#define SIM_EVENT_LOAD                  (1U)
+#define SIM_EVENT_EXPECT_LED            (2U)
+#define SIM_EVENT_REPEAT                (3U)
+#define SIM_EVENT_DET                   (4U)
+#define SIM_EVENT_GLITCH_LED            (5U)
+#define SIM_EVENT_COUNT                 (6U)
+#define SIM_EVENT_DET_STATS             (7U)
+#define SIM_EVENT_FAULTLOG              (8U)
+#define SIM_EVENT_FAULTLOG_RESET        (9U)
+
+/* Det_Key of the FAULTLOG events checking that there is no stored error of the age */
+#define SIM_FAULTLOG_NONE               (0xFFFFFFFFUL)
+
+/* Counters checked by the COUNT events, index in g_Sim_Counters */
+#define SIM_COUNTER_LATE_TICKS          (0U)
+#define SIM_COUNTER_LOST_TICKS          (1U)
+#define SIM_COUNTER_MISSES              (2U)
+#define SIM_COUNTER_DET_REPORTED        (3U)
+#define SIM_COUNTER_DET_RECORDED        (4U)
+#define SIM_COUNTER_DET_SUPPRESSED      (5U)
+#define SIM_COUNTER_BUTTON_PRESSED      (6U)    /* The button counters are in the order of the button event IDs */
+#define SIM_COUNTER_BUTTON_REPEAT       (10U)
+#define SIM_NUMBER_OF_COUNTERS          (11U)
+
+/* Number of the button event IDs, BUTTON_EVENT_PRESSED to BUTTON_EVENT_REPEAT */
+#define SIM_NUMBER_OF_BUTTON_EVENTS     (BUTTON_EVENT_REPEAT - BUTTON_EVENT_PRESSED + 1U)
+
+/* Highest number of the instances of a counter (tasks or buttons) */
+#define SIM_MAX_COUNTER_INDEXES         (8U)
+
+/* Default simulated time when neither -h nor -n is given */
+#define SIM_DEFAULT_HOURS               (24.0)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: One event of the input trace */
+typedef struct
+{
+    uint64 Time;
+    uint8 Type;
+    uint8 TaskID;
+    uint8 Led;          /* Index of the LED events in g_Sim_Led_Channels (LED1 is 0) */
+    uint8 Counter;      /* Counter and its instance of the COUNT events */
+    uint8 Index;
+    uint32 Value;
+    uint32 Det_Key;     /* Module in bits 0 - 15, API in bits 16 - 23 and error in bits 24 - 31 of the DET and FAULTLOG events */
+    uint32 Base;        /* Occurrences of the DET_STATS error at the start of the trace loop */
+}Sim_TraceEventType;
+
+/* Description: Name and number of the instances of a counter of the COUNT events */
+typedef struct
+{
+    const char * Name;
+    uint8 Number_Of_Indexes;
+}Sim_CounterType;
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* The virtual time in CPU cycles */
+static uint64 g_Sim_Time = 0;
+
+/* The virtual time at which the simulation stops */
+static uint64 g_Sim_End_Time = 0;
+
+/* The input trace, the index of the next event and the start time of the current trace loop */
+static Sim_TraceEventType g_Trace[SIM_MAX_TRACE_EVENTS];
+
+/* Dio channel of LED1 to LED3 used by the LED trace events */
+static const uint8 g_Sim_Led_Channels[] =
+{
+    DioConf_LED1_CHANNEL_ID_INDEX, DioConf_LED2_CHANNEL_ID_INDEX, DioConf_LED3_CHANNEL_ID_INDEX
+};
+static uint32 g_Trace_Length = 0;
+static uint32 g_Trace_Index = 0;
+static uint64 g_Trace_Loop_Start = 0;
+
+/* Execution time injected into the next run of each task in cycles */
+static uint64 g_Task_Load[OS_NUMBER_OF_TASKS];
+
+/* Number of the runs of each task */
+static uint64 g_Task_Runs[OS_NUMBER_OF_TASKS];
+
+/*
+ * SW1 press to LED1 change delay: time of the press waiting for its LED1 change, number of the measured presses,
+ * number of the presses replaced by the next press before any LED1 change (filtered bounces) and delays in cycles
+ */
+static boolean g_Press_Pending = FALSE;
+static uint64 g_Press_Time = 0;
+static uint32 g_Press_Count = 0;
+static uint32 g_Press_Ignored = 0;
+static uint64 g_Press_Delay_Sum = 0;
+static uint64 g_Press_Delay_Min = 0;
+static uint64 g_Press_Delay_Max = 0;
+
+/* Counters of the COUNT events and their values at the start of the current trace loop */
+static const Sim_CounterType g_Sim_Counters[SIM_NUMBER_OF_COUNTERS] =
+{
+    { "LATE_TICKS", 1U }, { "LOST_TICKS", 1U }, { "MISSES", OS_NUMBER_OF_TASKS },
+    { "DET_REPORTED", 1U }, { "DET_RECORDED", 1U }, { "DET_SUPPRESSED", 1U },
+    { "BUTTON_PRESSED", BUTTON_NUMBER_OF_BUTTONS }, { "BUTTON_RELEASED", BUTTON_NUMBER_OF_BUTTONS },
+    { "BUTTON_LONG_PRESS", BUTTON_NUMBER_OF_BUTTONS }, { "BUTTON_DOUBLE_CLICK", BUTTON_NUMBER_OF_BUTTONS },
+    { "BUTTON_REPEAT", BUTTON_NUMBER_OF_BUTTONS }
+};
+static uint32 g_Count_Base[SIM_NUMBER_OF_COUNTERS][SIM_MAX_COUNTER_INDEXES];
+
+/* Number of the events of each button pushed by the gesture engine, by event ID */
+static uint32 g_Button_Events[SIM_NUMBER_OF_BUTTON_EVENTS][BUTTON_NUMBER_OF_BUTTONS];
+
+/* Results of the EXPECT and COUNT events */
+static uint32 g_Expect_Passed = 0;
+static uint32 g_Expect_Failed = 0;
+
+/* Wall clock time at the start of the simulation */
+static struct timespec g_Wall_Start;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Sim_LoadTrace(const char * FileName);
+
+static void Sim_RunTraceEvents(uint64 Time);
+
+static uint32 Sim_ReadCounter(uint8 Counter, uint8 Index);
+
+static uint32 Sim_ReadDetOccurrences(uint32 DetKey);
+
+static uint32 Sim_ReadFaultLog(uint16 Age);
+
+static void Sim_StartCounters(void);
+
+static void Sim_Report(void);
+
+/*******************************************************************************
+ *                          Function definitions                               *
+ *******************************************************************************/
+
+int main(int argc, char * argv[])
+{
+    double hours = SIM_DEFAULT_HOURS;
+    uint64 ticks = 0;
+    int arg = 0;
+
+    for(arg = 1; arg < argc; arg++)
+    {
+        if((0 == strcmp(argv[arg], "-t")) && ((arg + 1) < argc))
+        {
+            Sim_LoadTrace(argv[++arg]);
+        }
+        else if((0 == strcmp(argv[arg], "-h")) && ((arg + 1) < argc))
+        {
+            hours = atof(argv[++arg]);
+        }
+        else if((0 == strcmp(argv[arg], "-n")) && ((arg + 1) < argc))
+        {
+            ticks = strtoull(argv[++arg], NULL, 10);
+        }
+        else if((0 == strcmp(argv[arg], "-u")) && ((arg + 1) < argc))
+        {
+            Sim_UartOpen(argv[++arg]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-t trace_file] [-h simulated_hours | -n ticks] [-u uart_capture_file]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if(0 != ticks)
+    {
+        g_Sim_End_Time = ticks * OS_BASE_TIME * SIM_CYCLES_PER_MS;
+    }
+    else
+    {
+        g_Sim_End_Time = (uint64)(hours * 3600.0 * 1000.0) * SIM_CYCLES_PER_MS;
+    }
+
+    /* SW1 has a pull up, it reads released until the trace presses it */
+    Sim_DioSetLevel(DioConf_SW1_CHANNEL_ID_INDEX, STD_HIGH);
+
+    clock_gettime(CLOCK_MONOTONIC, &g_Wall_Start);
+
+    /* Start the Os as main() does on the target, it returns only through Sim_Report */
+    Os_start();
+    return 0;
+}
+
+/*********************************************************************************************/
+
+/* Description: Called when the scheduler is idle, advance the virtual time to the next SysTick interrupt and run it */
+void Sim_Idle(void)
+{
+    uint64 next_time = Sim_GptNextInterrupt();
+
+    /* Stop at an earlier trace event, the interrupts it raises may activate tasks */
+    if((g_Trace_Length != 0) && ((g_Trace_Loop_Start + g_Trace[g_Trace_Index].Time) < next_time))
+    {
+        next_time = g_Trace_Loop_Start + g_Trace[g_Trace_Index].Time;
+    }
+    Sim_AdvanceTo(next_time);
+}
+
+/*********************************************************************************************/
+
+/* Description: Called by the scheduler after every task run, consume the execution time injected into the task */
+void Sim_PostTaskHook(uint8 TaskID)
+{
+    uint64 load = g_Task_Load[TaskID];
+
+    g_Task_Runs[TaskID]++;
+    if(0 != load)
+    {
+        /* The SysTick interrupts during the task run as they would preempt it */
+        g_Task_Load[TaskID] = 0;
+        Sim_AdvanceTo(g_Sim_Time + load);
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Called by the Button Module with each gesture event, count it for the COUNT events */
+void Sim_ButtonEventHook(uint16 EventId, uint8 ButtonId)
+{
+    if((EventId >= BUTTON_EVENT_PRESSED) && (EventId <= BUTTON_EVENT_REPEAT) && (ButtonId < BUTTON_NUMBER_OF_BUTTONS))
+    {
+        g_Button_Events[EventId - BUTTON_EVENT_PRESSED][ButtonId]++;
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Advance the virtual time to the required time, running the SysTick interrupts and the trace events on the way */
+void Sim_AdvanceTo(uint64 Time)
+{
+    uint64 next_interrupt = Sim_GptNextInterrupt();
+
+    while(next_interrupt <= Time)
+    {
+        if(next_interrupt > g_Sim_End_Time)
+        {
+            Sim_Report();
+        }
+        g_Sim_Time = next_interrupt;
+        Sim_RunTraceEvents(next_interrupt);
+        Sim_GptInterrupt();
+        next_interrupt = Sim_GptNextInterrupt();
+    }
+
+    g_Sim_Time = Time;
+    Sim_RunTraceEvents(Time);
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the virtual time in CPU cycles since the start of the simulation */
+uint64 Sim_GetTime(void)
+{
+    return g_Sim_Time;
+}
+
+/*********************************************************************************************/
+
+/* Description: Called by the simulation when an output changes its level, a LED1 change ends the pending SW1 press delay */
+void Sim_OutputChanged(uint8 ChannelId)
+{
+    uint64 delay = 0;
+
+    if((DioConf_LED1_CHANNEL_ID_INDEX == ChannelId) && (TRUE == g_Press_Pending))
+    {
+        delay = g_Sim_Time - g_Press_Time;
+        if((0 == g_Press_Count) || (delay < g_Press_Delay_Min))
+        {
+            g_Press_Delay_Min = delay;
+        }
+        if(delay > g_Press_Delay_Max)
+        {
+            g_Press_Delay_Max = delay;
+        }
+        g_Press_Delay_Sum += delay;
+        g_Press_Count++;
+        g_Press_Pending = FALSE;
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Apply the trace events due at or before the required time in order */
+static void Sim_RunTraceEvents(uint64 Time)
+{
+    const Sim_TraceEventType * Event_Ptr = NULL_PTR;
+    uint8 level = 0;
+    uint32 count = 0;
+    uint32 stored = 0;
+
+    while((g_Trace_Length != 0) && ((g_Trace_Loop_Start + g_Trace[g_Trace_Index].Time) <= Time))
+    {
+        Event_Ptr = &g_Trace[g_Trace_Index];
+        g_Trace_Index++;
+
+        switch(Event_Ptr->Type)
+        {
+        case SIM_EVENT_SW1:
+            /* The delay is measured from the last press edge before the LED1 change */
+            if((STD_LOW == Event_Ptr->Value) && (STD_HIGH == Sim_DioGetLevel(DioConf_SW1_CHANNEL_ID_INDEX)))
+            {
+                if(TRUE == g_Press_Pending)
+                {
+                    g_Press_Ignored++;
+                }
+                g_Press_Pending = TRUE;
+                g_Press_Time    = g_Trace_Loop_Start + Event_Ptr->Time;
+            }
+            Sim_DioSetLevel(DioConf_SW1_CHANNEL_ID_INDEX, (uint8)Event_Ptr->Value);
+            break;
+        case SIM_EVENT_LOAD:
+            g_Task_Load[Event_Ptr->TaskID] = Event_Ptr->Value * SIM_CYCLES_PER_MS;
+            break;
+        case SIM_EVENT_EXPECT_LED:
+            level = Sim_DioGetLevel(g_Sim_Led_Channels[Event_Ptr->Led]);
+            if(level == Event_Ptr->Value)
+            {
+                g_Expect_Passed++;
+            }
+            else
+            {
+                g_Expect_Failed++;
+                if(g_Expect_Failed <= 10)
+                {
+                    fprintf(stderr, "EXPECT LED%u %u failed at %.3f s (level %u)\n", (unsigned)Event_Ptr->Led + 1U, (unsigned)Event_Ptr->Value,
+                            (double)(g_Trace_Loop_Start + Event_Ptr->Time) / SIM_CPU_CLOCK_HZ, (unsigned)level);
+                }
+            }
+            break;
+        case SIM_EVENT_GLITCH_LED:
+            Sim_DioGlitch(g_Sim_Led_Channels[Event_Ptr->Led]);
+            break;
+        case SIM_EVENT_COUNT:
+            count = Sim_ReadCounter(Event_Ptr->Counter, Event_Ptr->Index) - g_Count_Base[Event_Ptr->Counter][Event_Ptr->Index];
+            if(count == Event_Ptr->Value)
+            {
+                g_Expect_Passed++;
+            }
+            else
+            {
+                g_Expect_Failed++;
+                if(g_Expect_Failed <= 10)
+                {
+                    fprintf(stderr, "COUNT %s %u %u failed at %.3f s (count %u)\n", g_Sim_Counters[Event_Ptr->Counter].Name,
+                            (unsigned)Event_Ptr->Index, (unsigned)Event_Ptr->Value,
+                            (double)(g_Trace_Loop_Start + Event_Ptr->Time) / SIM_CPU_CLOCK_HZ, (unsigned)count);
+                }
+            }
+            break;
+        case SIM_EVENT_DET:
+            (void)Det_ReportError((uint16)(Event_Ptr->Det_Key & 0xFFFFU), 0U,
+                                  (uint8)((Event_Ptr->Det_Key >> 16) & 0xFFU), (uint8)(Event_Ptr->Det_Key >> 24));
+            break;
+        case SIM_EVENT_DET_STATS:
+            count = Sim_ReadDetOccurrences(Event_Ptr->Det_Key) - Event_Ptr->Base;
+            if(count == Event_Ptr->Value)
+            {
+                g_Expect_Passed++;
+            }
+            else
+            {
+                g_Expect_Failed++;
+                if(g_Expect_Failed <= 10)
+                {
+                    fprintf(stderr, "DET_STATS %u %u %u %u failed at %.3f s (count %u)\n", (unsigned)(Event_Ptr->Det_Key & 0xFFFFU),
+                            (unsigned)((Event_Ptr->Det_Key >> 16) & 0xFFU), (unsigned)(Event_Ptr->Det_Key >> 24), (unsigned)Event_Ptr->Value,
+                            (double)(g_Trace_Loop_Start + Event_Ptr->Time) / SIM_CPU_CLOCK_HZ, (unsigned)count);
+                }
+            }
+            break;
+        case SIM_EVENT_FAULTLOG:
+            stored = Sim_ReadFaultLog((uint16)Event_Ptr->Value);
+            if(stored == Event_Ptr->Det_Key)
+            {
+                g_Expect_Passed++;
+            }
+            else
+            {
+                g_Expect_Failed++;
+                if(g_Expect_Failed <= 10)
+                {
+                    fprintf(stderr, "FAULTLOG %u 0x%08X failed at %.3f s (stored 0x%08X)\n", (unsigned)Event_Ptr->Value,
+                            (unsigned)Event_Ptr->Det_Key, (double)(g_Trace_Loop_Start + Event_Ptr->Time) / SIM_CPU_CLOCK_HZ,
+                            (unsigned)stored);
+                }
+            }
+            break;
+        case SIM_EVENT_FAULTLOG_RESET:
+            Eep_Init();
+            FaultLog_Init();
+            break;
+        case SIM_EVENT_REPEAT:
+            g_Trace_Loop_Start += Event_Ptr->Time;
+            g_Trace_Index = 0;
+            Sim_StartCounters();
+            break;
+        default:
+            break;
+        }
+
+        if(g_Trace_Index == g_Trace_Length)
+        {
+            /* End of a trace without REPEAT, the inputs keep their last levels */
+            g_Trace_Length = 0;
+        }
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the current value of an instance of a counter of the COUNT events */
+static uint32 Sim_ReadCounter(uint8 Counter, uint8 Index)
+{
+    uint32 value = 0;
+
+    switch(Counter)
+    {
+    case SIM_COUNTER_LATE_TICKS:
+        value = Os_GetLateTickCount();
+        break;
+    case SIM_COUNTER_LOST_TICKS:
+        value = Os_GetLostTickCount();
+        break;
+    case SIM_COUNTER_MISSES:
+        value = Os_GetDeadlineMissCount(Index);
+        break;
+    case SIM_COUNTER_DET_REPORTED:
+        value = Det_GetTotalErrorCount();
+        break;
+    case SIM_COUNTER_DET_RECORDED:
+        value = Det_GetRecordedCount();
+        break;
+    case SIM_COUNTER_DET_SUPPRESSED:
+        value = Det_GetSuppressedCount();
+        break;
+    default:
+        if((Counter >= SIM_COUNTER_BUTTON_PRESSED) && (Counter <= SIM_COUNTER_BUTTON_REPEAT))
+        {
+            value = g_Button_Events[Counter - SIM_COUNTER_BUTTON_PRESSED][Index];
+        }
+        break;
+    }
+    return value;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the occurrences of an error in the Det statistics, 0 if it was not reported */
+static uint32 Sim_ReadDetOccurrences(uint32 DetKey)
+{
+    Det_ErrorStatsType stats;
+    uint32 value = 0;
+
+    if(E_OK == Det_GetErrorStats((uint16)(DetKey & 0xFFFFU), (uint8)((DetKey >> 16) & 0xFFU), (uint8)(DetKey >> 24), &stats))
+    {
+        value = stats.Count;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return value;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the Det_Key of the stored error of the age in the fault log, SIM_FAULTLOG_NONE if there is none */
+static uint32 Sim_ReadFaultLog(uint16 Age)
+{
+    Det_ErrorRecordType record;
+    uint32 value = SIM_FAULTLOG_NONE;
+
+    if(E_OK == FaultLog_GetRecord(Age, &record))
+    {
+        value = (uint32)record.ModuleId | ((uint32)record.ApiId << 16) | ((uint32)record.ErrorId << 24);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return value;
+}
+
+/*********************************************************************************************/
+
+/*
+ * Description: Keep the counters values at the start of a trace loop, the COUNT and DET_STATS events
+ *              check the increase from them
+ */
+static void Sim_StartCounters(void)
+{
+    uint8 Counter = 0;
+    uint8 Index = 0;
+    uint32 event = 0;
+
+    for(Counter = 0; Counter < SIM_NUMBER_OF_COUNTERS; Counter++)
+    {
+        for(Index = 0; Index < g_Sim_Counters[Counter].Number_Of_Indexes; Index++)
+        {
+            g_Count_Base[Counter][Index] = Sim_ReadCounter(Counter, Index);
+        }
+    }
+    for(event = 0; event < g_Trace_Length; event++)
+    {
+        if(SIM_EVENT_DET_STATS == g_Trace[event].Type)
+        {
+            g_Trace[event].Base = Sim_ReadDetOccurrences(g_Trace[event].Det_Key);
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+}
+
+/*********************************************************************************************/
+
+/* Description: Read the input trace file into g_Trace */
+static void Sim_LoadTrace(const char * FileName)
+{
+    FILE * file = fopen(FileName, "r");
+    char line[128];
+    char command[16];
+    char name[24];
+    unsigned long time = 0, task = 0, value = 0, api = 0, error = 0;
+    int fields = 0;
+    uint8 Counter = 0;
+    Sim_TraceEventType * Event_Ptr = NULL_PTR;
+
+    if(NULL == file)
+    {
+        fprintf(stderr, "can not open the trace file %s\n", FileName);
+        exit(2);
+    }
+
+    while(NULL != fgets(line, sizeof(line), file))
+    {
+        if(('#' == line[0]) || (sscanf(line, "%lu %15s", &time, command) != 2))
+        {
+            continue;
+        }
+        if(g_Trace_Length == SIM_MAX_TRACE_EVENTS)
+        {
+            fprintf(stderr, "the trace has more than %u events\n", SIM_MAX_TRACE_EVENTS);
+            exit(2);
+        }
+
+        Event_Ptr = &g_Trace[g_Trace_Length];
+        Event_Ptr->Time = time * SIM_CYCLES_PER_MS;
+        if((0 == strcmp(command, "SW1")) && (sscanf(line, "%*u %*s %lu", &value) == 1))
+        {
+            Event_Ptr->Type  = SIM_EVENT_SW1;
+            Event_Ptr->Value = (value != 0) ? STD_HIGH : STD_LOW;
+        }
+        else if((0 == strcmp(command, "LOAD")) && (sscanf(line, "%*u %*s %lu %lu", &task, &value) == 2)
+                && (task < OS_NUMBER_OF_TASKS))
+        {
+            Event_Ptr->Type   = SIM_EVENT_LOAD;
+            Event_Ptr->TaskID = (uint8)task;
+            Event_Ptr->Value  = (uint32)value;
+        }
+        else if((0 == strcmp(command, "EXPECT")) && (sscanf(line, "%*u %*s LED%lu %lu", &task, &value) == 2)
+                && (task >= 1) && (task <= sizeof(g_Sim_Led_Channels)))
+        {
+            Event_Ptr->Type  = SIM_EVENT_EXPECT_LED;
+            Event_Ptr->Led   = (uint8)(task - 1U);
+            Event_Ptr->Value = (value != 0) ? STD_HIGH : STD_LOW;
+        }
+        else if((0 == strcmp(command, "GLITCH")) && (sscanf(line, "%*u %*s LED%lu", &task) == 1)
+                && (task >= 1) && (task <= sizeof(g_Sim_Led_Channels)))
+        {
+            Event_Ptr->Type = SIM_EVENT_GLITCH_LED;
+            Event_Ptr->Led  = (uint8)(task - 1U);
+        }
+        else if((0 == strcmp(command, "DET")) && (sscanf(line, "%*u %*s %lu %lu %lu", &value, &api, &error) == 3)
+                && (value <= 0xFFFFU) && (api <= 0xFFU) && (error <= 0xFFU))
+        {
+            Event_Ptr->Type    = SIM_EVENT_DET;
+            Event_Ptr->Det_Key = (uint32)value | ((uint32)api << 16) | ((uint32)error << 24);
+        }
+        else if((0 == strcmp(command, "DET_STATS")) && (sscanf(line, "%*u %*s %lu %lu %lu %lu", &task, &api, &error, &value) == 4)
+                && (task <= 0xFFFFU) && (api <= 0xFFU) && (error <= 0xFFU))
+        {
+            Event_Ptr->Type    = SIM_EVENT_DET_STATS;
+            Event_Ptr->Det_Key = (uint32)task | ((uint32)api << 16) | ((uint32)error << 24);
+            Event_Ptr->Value   = (uint32)value;
+        }
+        else if((0 == strcmp(command, "COUNT"))
+                && ((fields = sscanf(line, "%*u %*s %23s %lu %lu", name, &task, &value)) >= 2))
+        {
+            /* Without index the second number is the count */
+            if(2 == fields)
+            {
+                value = task;
+                task  = 0;
+            }
+            for(Counter = 0; (Counter < SIM_NUMBER_OF_COUNTERS) && (0 != strcmp(name, g_Sim_Counters[Counter].Name)); Counter++)
+            {
+            }
+            if((Counter == SIM_NUMBER_OF_COUNTERS) || (task >= g_Sim_Counters[Counter].Number_Of_Indexes)
+               || ((3 == fields) != (g_Sim_Counters[Counter].Number_Of_Indexes > 1U)))
+            {
+                fprintf(stderr, "invalid counter: %s", line);
+                exit(2);
+            }
+            Event_Ptr->Type    = SIM_EVENT_COUNT;
+            Event_Ptr->Counter = Counter;
+            Event_Ptr->Index   = (uint8)task;
+            Event_Ptr->Value   = (uint32)value;
+        }
+        else if((0 == strcmp(command, "FAULTLOG")) && (sscanf(line, "%*u %*s %lu %15s", &value, name) == 2)
+                && (value <= 0xFFFFU) && (0 == strcmp(name, "NONE")))
+        {
+            Event_Ptr->Type    = SIM_EVENT_FAULTLOG;
+            Event_Ptr->Value   = (uint32)value;
+            Event_Ptr->Det_Key = SIM_FAULTLOG_NONE;
+        }
+        else if((0 == strcmp(command, "FAULTLOG")) && (sscanf(line, "%*u %*s %lu %lu %lu %lu", &value, &task, &api, &error) == 4)
+                && (value <= 0xFFFFU) && (task <= 0xFFFFU) && (api <= 0xFFU) && (error <= 0xFFU))
+        {
+            Event_Ptr->Type    = SIM_EVENT_FAULTLOG;
+            Event_Ptr->Value   = (uint32)value;
+            Event_Ptr->Det_Key = (uint32)task | ((uint32)api << 16) | ((uint32)error << 24);
+        }
+        else if(0 == strcmp(command, "FAULTLOG_RESET"))
+        {
+            Event_Ptr->Type = SIM_EVENT_FAULTLOG_RESET;
+        }
+        else if((0 == strcmp(command, "REPEAT")) && (time != 0))
+        {
+            Event_Ptr->Type = SIM_EVENT_REPEAT;
+        }
+        else
+        {
+            fprintf(stderr, "invalid trace line: %s", line);
+            exit(2);
+        }
+
+        if((g_Trace_Length != 0) && (Event_Ptr->Time < g_Trace[g_Trace_Length - 1].Time))
+        {
+            fprintf(stderr, "the trace events are not in time order: %s", line);
+            exit(2);
+        }
+        g_Trace_Length++;
+    }
+    fclose(file);
+}
+
+/*********************************************************************************************/
+
+/* Description: Print the results of the run and end the simulation */
+static void Sim_Report(void)
+{
+    struct timespec wall_end;
+    double wall_seconds = 0;
+    double simulated_hours = (double)g_Sim_Time / SIM_CPU_CLOCK_HZ / 3600.0;
+    Os_TaskType TaskID = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    wall_seconds = (double)(wall_end.tv_sec - g_Wall_Start.tv_sec) + ((double)(wall_end.tv_nsec - g_Wall_Start.tv_nsec) / 1e9);
+
+    printf("Simulated time     : %.2f h (%u ticks of %u ms)\n", simulated_hours, (unsigned)Os_GetTickCount(), (unsigned)OS_BASE_TIME);
+    printf("SysTick interrupts : %llu\n", (unsigned long long)Sim_GptInterruptCount());
+    printf("Wall time          : %.3f s\n", wall_seconds);
+    if(wall_seconds > 0)
+    {
+        printf("Throughput         : %.1f simulated hours per wall second\n", simulated_hours / wall_seconds);
+    }
+    printf("LED1 toggles       : %u\n", (unsigned)Sim_DioGetEdgeCount(DioConf_LED1_CHANNEL_ID_INDEX));
+    printf("LED glitches fixed : %u\n", (unsigned)Led_GetGlitchCount());
+    printf("LED PWM updates    : %u (%u pin mode changes)\n", (unsigned)Sim_PwmGetUpdateCount(), (unsigned)Sim_PortGetModeChangeCount());
+    printf("Late ticks         : %u (%u lost)\n", (unsigned)Os_GetLateTickCount(), (unsigned)Os_GetLostTickCount());
+    for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+    {
+        printf("Task %u deadline misses : %u\n", (unsigned)TaskID, (unsigned)Os_GetDeadlineMissCount(TaskID));
+    }
+    for(TaskID = 0; TaskID < OS_NUMBER_OF_TASKS; TaskID++)
+    {
+        printf("Task %u runs        : %llu\n", (unsigned)TaskID, (unsigned long long)g_Task_Runs[TaskID]);
+    }
+    if(0 != g_Press_Count)
+    {
+        printf("SW1 press to LED1  : %u presses (%u press edges without LED1 change), min %.1f ms, avg %.1f ms, max %.1f ms\n",
+               (unsigned)g_Press_Count, (unsigned)g_Press_Ignored, (double)g_Press_Delay_Min / SIM_CYCLES_PER_MS,
+               (double)g_Press_Delay_Sum / g_Press_Count / SIM_CYCLES_PER_MS, (double)g_Press_Delay_Max / SIM_CYCLES_PER_MS);
+    }
+    printf("Det errors         : %u reported, %u rate limited\n", (unsigned)Det_GetTotalErrorCount(), (unsigned)Det_GetSuppressedCount());
+    printf("Fault log lost     : %u\n", (unsigned)FaultLog_GetLostCount());
+    printf("EEPROM word writes : %u (most written word %u)\n", (unsigned)Sim_EepGetWriteCount(), (unsigned)Sim_EepGetMaxWordWrites());
+    printf("UART bytes         : %llu (%u trace frames dropped)\n", (unsigned long long)Sim_UartClose(), (unsigned)Trace_GetDroppedCount());
+    printf("EXPECT checks      : %u passed, %u failed\n", (unsigned)g_Expect_Passed, (unsigned)g_Expect_Failed);
+
+    exit((0 == g_Expect_Failed) ? 0 : 1);
+}
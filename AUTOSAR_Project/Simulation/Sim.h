@@ -0,0 +1,104 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim.h
+ *
+ * Description: Header file for the host simulation of the Os Scheduler with a virtual clock.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include "Std_Types.h"
+#include "MCAL/MCU/Mcu_Cfg.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Simulated CPU clock, the system clock configured in the Mcu Driver */
+#define SIM_CPU_CLOCK_HZ                    ((unsigned long long)MCU_SYSTEM_CLOCK_HZ)
+
+/* Number of CPU cycles in one millisecond of virtual time */
+#define SIM_CYCLES_PER_MS                   (SIM_CPU_CLOCK_HZ / 1000ULL)
+
+/* Maximum number of the events in the input trace */
+#define SIM_MAX_TRACE_EVENTS                (256U)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Description: Called when the scheduler is idle, advance the virtual time to the next SysTick interrupt and run it */
+void Sim_Idle(void);
+
+/* Description: Called by the scheduler after every task run, consume the execution time injected into the task */
+void Sim_PostTaskHook(uint8 TaskID);
+
+/* Description: Called by the Button Module with each gesture event, count it for the COUNT events */
+void Sim_ButtonEventHook(uint16 EventId, uint8 ButtonId);
+
+/* Description: Advance the virtual time to the required time, running the SysTick interrupts and the trace events on the way */
+void Sim_AdvanceTo(uint64 Time);
+
+/* Description: Return the virtual time in CPU cycles since the start of the simulation */
+uint64 Sim_GetTime(void);
+
+/* Description: Return the time of the next SysTick interrupt in CPU cycles, all ones if the timer is stopped (Sim_Gpt.c) */
+uint64 Sim_GptNextInterrupt(void);
+
+/* Description: Run the SysTick interrupt due at the current virtual time and schedule the next one (Sim_Gpt.c) */
+void Sim_GptInterrupt(void);
+
+/* Description: Return the number of the simulated SysTick interrupts (Sim_Gpt.c) */
+uint64 Sim_GptInterruptCount(void);
+
+/* Description: Drive the level of a configured Dio channel as an external input (Sim_Dio.c) */
+void Sim_DioSetLevel(uint8 ChannelId, uint8 Level);
+
+/* Description: Flip the level of a configured Dio channel behind the back of its driver (an output glitch) (Sim_Dio.c) */
+void Sim_DioGlitch(uint8 ChannelId);
+
+/* Description: Return the level of a configured Dio channel (Sim_Dio.c) */
+uint8 Sim_DioGetLevel(uint8 ChannelId);
+
+/* Description: Return the number of the level changes written to a configured Dio channel (Sim_Dio.c) */
+uint32 Sim_DioGetEdgeCount(uint8 ChannelId);
+
+/* Description: Called by the simulation when an output changes its level (Sim.c) */
+void Sim_OutputChanged(uint8 ChannelId);
+
+/* Description: Latch the edge of an input pin in the channels detecting it and raise the port interrupt if it is unmasked (Sim_Icu.c) */
+void Sim_IcuInputChanged(uint8 Port, uint8 Pin, uint8 Level);
+
+/* Description: Return the mode of a pin set by Port_SetPinMode, 0 for Dio (Sim_Port.c) */
+uint8 Sim_PortGetPinMode(uint8 Pin);
+
+/* Description: Return the number of the pin mode changes by Port_SetPinMode (Sim_Port.c) */
+uint32 Sim_PortGetModeChangeCount(void);
+
+/* Description: Return the applied duty cycle of a PWM channel (Sim_Pwm.c) */
+uint16 Sim_PwmGetDutyCycle(uint8 ChannelNumber);
+
+/* Description: Return the number of the applied PWM updates (Sim_Pwm.c) */
+uint32 Sim_PwmGetUpdateCount(void);
+
+/* Description: Run the installed handler of a peripheral interrupt if it is enabled (Sim_Irq.c) */
+void Sim_IrqRaise(uint8 IrqNumber);
+
+/* Description: Return the number of the word writes since the start of the simulation (Sim_Eep.c) */
+uint32 Sim_EepGetWriteCount(void);
+
+/* Description: Return the highest number of writes of one word (the wear of the most written word) (Sim_Eep.c) */
+uint32 Sim_EepGetMaxWordWrites(void);
+
+/* Description: Write the sent bytes to this capture file (binary), it is closed by Sim_UartClose (Sim_Uart.c) */
+void Sim_UartOpen(const char * FileName);
+
+/* Description: Send the bytes left in the ring buffer, close the capture file and return the number of the sent bytes (Sim_Uart.c) */
+uint64 Sim_UartClose(void);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,192 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Dio.c
+ *
+ * Description: Host stand-in of the DIO Driver using virtual port data registers.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "MCAL/Dio/Dio.h"
+#include "Sim.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Number of the GPIO ports (PORTA to PORTF) */
+#define SIM_DIO_NUMBER_OF_PORTS         (6U)
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* Virtual data register of each port */
+static uint8 g_Port_Data[SIM_DIO_NUMBER_OF_PORTS];
+
+/* Number of the level changes written to each configured channel */
+static uint32 g_Channel_Edges[DIO_CONFIGURED_CHANNLES];
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: The stand-in uses Dio_Configuration directly, the virtual ports keep the driven input levels */
+void Dio_Init(const Dio_ConfigType * ConfigPtr)
+{
+    (void)ConfigPtr;
+}
+
+/************************************************************************************/
+
+/* Description: Read the level of a channel from its virtual port */
+Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
+{
+    return Sim_DioGetLevel(ChannelId);
+}
+
+/************************************************************************************/
+
+/* Description: Write the level of a channel to its virtual port and count the level changes */
+void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    if(Level != Sim_DioGetLevel(ChannelId))
+    {
+        g_Channel_Edges[ChannelId]++;
+        Sim_DioSetLevel(ChannelId, Level);
+        Sim_OutputChanged(ChannelId);
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Read the virtual port */
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+    return g_Port_Data[PortId];
+}
+
+/************************************************************************************/
+
+/* Description: Write the virtual port */
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+    g_Port_Data[PortId] = Level;
+}
+
+/************************************************************************************/
+
+#if (DIO_MASKED_WRITE_PORT_API == STD_ON)
+/* Description: Write the masked channels of the virtual port and count the level changes of the configured channels */
+void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask)
+{
+    Dio_PortLevelType changed = (Dio_PortLevelType)((g_Port_Data[PortId] ^ Level) & Mask);
+    Dio_ChannelType ChannelId = 0;
+
+    g_Port_Data[PortId] ^= changed;
+    for(ChannelId = 0; ChannelId < DIO_CONFIGURED_CHANNLES; ChannelId++)
+    {
+        if((PortId == Dio_Configuration.Channels[ChannelId].Port_Num)
+           && (BIT_IS_SET(changed, Dio_Configuration.Channels[ChannelId].Ch_Num)))
+        {
+            g_Channel_Edges[ChannelId]++;
+            Sim_OutputChanged(ChannelId);
+        }
+    }
+}
+#endif
+
+/************************************************************************************/
+
+/* Description: Read a channel group from its virtual port */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+    return (g_Port_Data[ChannelGroupIdPtr->PortIndex] & ChannelGroupIdPtr->mask) >> ChannelGroupIdPtr->offset;
+}
+
+/************************************************************************************/
+
+/* Description: Write a channel group to its virtual port */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+    g_Port_Data[ChannelGroupIdPtr->PortIndex] = (g_Port_Data[ChannelGroupIdPtr->PortIndex] & ~ChannelGroupIdPtr->mask)
+                                                | ((Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask);
+}
+
+/************************************************************************************/
+
+#if (DIO_VERSION_INFO_API == STD_ON)
+/* Description: Return the version information of the Dio module */
+void Dio_GetVersionInfo(Std_VersionInfoType * versioninfo)
+{
+    versioninfo->vendorID = (uint16)DIO_VENDOR_ID;
+    versioninfo->moduleID = (uint16)DIO_MODULE_ID;
+    versioninfo->sw_major_version = (uint8)DIO_SW_MAJOR_VERSION;
+    versioninfo->sw_minor_version = (uint8)DIO_SW_MINOR_VERSION;
+    versioninfo->sw_patch_version = (uint8)DIO_SW_PATCH_VERSION;
+}
+#endif
+
+/************************************************************************************/
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+/* Description: Flip the level of a channel and return the new level */
+Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+{
+    Dio_LevelType level = (STD_HIGH == Sim_DioGetLevel(ChannelId)) ? STD_LOW : STD_HIGH;
+
+    Dio_WriteChannel(ChannelId, level);
+    return level;
+}
+#endif
+
+/************************************************************************************/
+
+/* Description: Drive the level of a configured Dio channel as an external input, a level change is an edge for the ICU */
+void Sim_DioSetLevel(uint8 ChannelId, uint8 Level)
+{
+    const Dio_ConfigChannel * Channel_Ptr = &Dio_Configuration.Channels[ChannelId];
+
+    if(Level != Sim_DioGetLevel(ChannelId))
+    {
+        if(STD_HIGH == Level)
+        {
+            SET_BIT(g_Port_Data[Channel_Ptr->Port_Num], Channel_Ptr->Ch_Num);
+        }
+        else
+        {
+            CLEAR_BIT(g_Port_Data[Channel_Ptr->Port_Num], Channel_Ptr->Ch_Num);
+        }
+        Sim_IcuInputChanged(Channel_Ptr->Port_Num, Channel_Ptr->Ch_Num, Level);
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Flip the level of a configured Dio channel behind the back of its driver (an output glitch) */
+void Sim_DioGlitch(uint8 ChannelId)
+{
+    const Dio_ConfigChannel * Channel_Ptr = &Dio_Configuration.Channels[ChannelId];
+
+    g_Port_Data[Channel_Ptr->Port_Num] ^= (uint8)(1U << Channel_Ptr->Ch_Num);
+}
+
+/************************************************************************************/
+
+/* Description: Return the level of a configured Dio channel */
+uint8 Sim_DioGetLevel(uint8 ChannelId)
+{
+    const Dio_ConfigChannel * Channel_Ptr = &Dio_Configuration.Channels[ChannelId];
+
+    return (BIT_IS_SET(g_Port_Data[Channel_Ptr->Port_Num], Channel_Ptr->Ch_Num)) ? STD_HIGH : STD_LOW;
+}
+
+/************************************************************************************/
+
+/* Description: Return the number of the level changes written to a configured Dio channel */
+uint32 Sim_DioGetEdgeCount(uint8 ChannelId)
+{
+    return g_Channel_Edges[ChannelId];
+}
@@ -0,0 +1,164 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Eep.c
+ *
+ * Description: Host stand-in of the EEPROM Driver using a RAM array that starts erased.
+ *              Each word write keeps the EEPROM busy for SIM_EEP_WORD_WRITE_US of virtual
+ *              time and is counted per word to check the wear of the fault log.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "MCAL/EEP/Eep.h"
+#include "Sim.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Busy time of one word write, an assumed model value and not a measured one */
+#define SIM_EEP_WORD_WRITE_US           (500U)
+
+#define SIM_EEP_NUMBER_OF_WORDS         (EEP_NUMBER_OF_BLOCKS * EEP_WORDS_PER_BLOCK)
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* The virtual EEPROM, erased at the start of the simulation */
+static uint32 g_Eep_Words[SIM_EEP_NUMBER_OF_WORDS];
+static uint32 g_Eep_Word_Writes[SIM_EEP_NUMBER_OF_WORDS];
+static uint32 g_Eep_Write_Count = 0;
+
+static Eep_StatusType g_Eep_Status = EEP_UNINIT;
+
+/* The running write job and the virtual time at which the last word write ends */
+static const uint32 * g_Eep_Write_Data_Ptr = NULL_PTR;
+static uint32 g_Eep_Write_Address = 0;
+static uint8 g_Eep_Write_Words = 0;
+static uint8 g_Eep_Write_Index = 0;
+static uint64 g_Eep_Busy_Until = 0;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/*
+ * Description: Erase the virtual EEPROM on the first call only, it keeps its content across Eep_Init like the target
+ *              and a running write job is dropped like a job interrupted by a reset
+ */
+void Eep_Init(void)
+{
+    uint32 word = 0;
+
+    if(EEP_UNINIT == g_Eep_Status)
+    {
+        for(word = 0; word < SIM_EEP_NUMBER_OF_WORDS; word++)
+        {
+            g_Eep_Words[word] = EEP_ERASED_WORD;
+        }
+    }
+    g_Eep_Status = EEP_IDLE;
+}
+
+/************************************************************************************/
+
+/* Description: Copy words from the start of a virtual block */
+Std_ReturnType Eep_Read(uint8 Block, uint32 * Data_Ptr, uint8 Words)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 index = 0;
+
+    if((EEP_UNINIT != g_Eep_Status) && (EEP_BUSY != g_Eep_Status) && (NULL_PTR != Data_Ptr)
+        && (Block < EEP_NUMBER_OF_BLOCKS) && (Words <= EEP_WORDS_PER_BLOCK))
+    {
+        for(index = 0; index < Words; index++)
+        {
+            Data_Ptr[index] = g_Eep_Words[(Block * EEP_WORDS_PER_BLOCK) + index];
+        }
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/************************************************************************************/
+
+/* Description: Start a write job to a virtual block from the required word */
+Std_ReturnType Eep_Write(uint8 Block, uint8 Offset, const uint32 * Data_Ptr, uint8 Words)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((EEP_UNINIT != g_Eep_Status) && (EEP_BUSY != g_Eep_Status) && (NULL_PTR != Data_Ptr)
+        && (Block < EEP_NUMBER_OF_BLOCKS) && (Words > 0) && (Offset < EEP_WORDS_PER_BLOCK)
+        && (Words <= (EEP_WORDS_PER_BLOCK - Offset)))
+    {
+        g_Eep_Write_Data_Ptr = Data_Ptr;
+        g_Eep_Write_Address  = (Block * EEP_WORDS_PER_BLOCK) + Offset;
+        g_Eep_Write_Words    = Words;
+        g_Eep_Write_Index    = 0;
+        g_Eep_Status         = EEP_BUSY;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/************************************************************************************/
+
+/* Description: Return the state of the stand-in */
+Eep_StatusType Eep_GetStatus(void)
+{
+    return g_Eep_Status;
+}
+
+/************************************************************************************/
+
+/* Description: Write the next word when the previous one is over in virtual time, as the target does with EEDONE */
+void Eep_MainFunction(void)
+{
+    uint32 address = 0;
+
+    if((EEP_BUSY == g_Eep_Status) && (Sim_GetTime() >= g_Eep_Busy_Until))
+    {
+        if(g_Eep_Write_Index < g_Eep_Write_Words)
+        {
+            address = g_Eep_Write_Address + g_Eep_Write_Index;
+            g_Eep_Words[address] = g_Eep_Write_Data_Ptr[g_Eep_Write_Index];
+            g_Eep_Word_Writes[address]++;
+            g_Eep_Write_Count++;
+            g_Eep_Write_Index++;
+            g_Eep_Busy_Until = Sim_GetTime() + ((uint64)SIM_EEP_WORD_WRITE_US * SIM_CYCLES_PER_MS / 1000ULL);
+        }
+        else
+        {
+            g_Eep_Status = EEP_IDLE;
+        }
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Return the number of the word writes since the start of the simulation */
+uint32 Sim_EepGetWriteCount(void)
+{
+    return g_Eep_Write_Count;
+}
+
+/************************************************************************************/
+
+/* Description: Return the highest number of writes of one word (the wear of the most written word) */
+uint32 Sim_EepGetMaxWordWrites(void)
+{
+    uint32 max_writes = 0;
+    uint32 word = 0;
+
+    for(word = 0; word < SIM_EEP_NUMBER_OF_WORDS; word++)
+    {
+        if(g_Eep_Word_Writes[word] > max_writes)
+        {
+            max_writes = g_Eep_Word_Writes[word];
+        }
+    }
+    return max_writes;
+}
@@ -0,0 +1,277 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Gpt.c
+ *
+ * Description: Host stand-in of the GPT Driver (SysTick and DWT) running on the virtual clock.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "MCAL/GPT/Gpt.h"
+#include "Sim.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+#define SIM_SYSTICK_MAX_COUNT           0x01000000         // Number of counts of the 24-bit SysTick counter.
+#define SIM_TIMER_STOPPED               0xFFFFFFFFFFFFFFFFULL
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Function called by the SysTick interrupt every Divisor periods */
+typedef struct
+{
+    void (*Callback_Ptr)(void);
+    uint32 Count;
+    uint16 Divisor;
+    uint8 Priority;
+}Sim_SubscriberType;
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* Global pointer to function used to point upper layer functions to be used in Call Back */
+static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
+
+/* The functions called by the SysTick interrupt sorted by their priority */
+static Sim_SubscriberType g_SysTick_Subscribers[GPT_SYSTICK_MAX_SUBSCRIBERS];
+static uint8 g_SysTick_Subscribers_Count = 0;
+
+/* Number of the base periods of the current interrupt */
+static uint16 g_SysTick_Periods = 1;
+
+/* The base period of the SysTick in cycles */
+static uint64 g_SysTick_Period = 0;
+
+/* Time of the last and the next SysTick interrupts in cycles */
+static uint64 g_SysTick_Last_Interrupt = 0;
+static uint64 g_SysTick_Next_Interrupt = SIM_TIMER_STOPPED;
+
+/* Number of the simulated interrupts */
+static uint64 g_SysTick_Interrupt_Count = 0;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: Handler for SysTick interrupt use to call the subscribed functions in their priority order */
+void SysTick_Handler(void)
+{
+    Sim_SubscriberType * Subscriber_Ptr = &g_SysTick_Subscribers[0];
+    uint8 index = 0;
+
+    for(index = 0; index < g_SysTick_Subscribers_Count; index++)
+    {
+        Subscriber_Ptr->Count += g_SysTick_Periods;
+        if(Subscriber_Ptr->Count >= Subscriber_Ptr->Divisor)
+        {
+            Subscriber_Ptr->Count %= Subscriber_Ptr->Divisor;
+            (*Subscriber_Ptr->Callback_Ptr)();
+        }
+        Subscriber_Ptr++;
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Start the periodic SysTick interrupt every n miliseconds of virtual time */
+void SysTick_Init(uint16 a_TimeInMilliSeconds)
+{
+    g_SysTick_Period         = SIM_CYCLES_PER_MS * a_TimeInMilliSeconds;
+    g_SysTick_Last_Interrupt = Sim_GetTime();
+    g_SysTick_Next_Interrupt = g_SysTick_Last_Interrupt + g_SysTick_Period;
+}
+
+/************************************************************************************/
+
+/* Description: Delay the next SysTick interrupt to a_Periods base periods after the last interrupt */
+uint16 SysTick_SetNextInterrupt(uint16 a_Periods)
+{
+    uint64 max_periods = SIM_SYSTICK_MAX_COUNT / g_SysTick_Period;
+    uint16 periods = a_Periods;
+
+    /* Same limit as the 24-bit counter of the target */
+    if(periods > max_periods)
+    {
+        periods = (uint16)max_periods;
+    }
+    if(periods > 1)
+    {
+        g_SysTick_Next_Interrupt = g_SysTick_Last_Interrupt + (periods * g_SysTick_Period);
+    }
+    else
+    {
+        periods = 1;
+    }
+    return periods;
+}
+
+/************************************************************************************/
+
+/* Description: Busy wait n miliseconds of virtual time */
+void SysTick_StartBusyWait(uint16 a_TimeInMilliSeconds)
+{
+    Sim_AdvanceTo(Sim_GetTime() + (SIM_CYCLES_PER_MS * a_TimeInMilliSeconds));
+}
+
+/************************************************************************************/
+
+/* Description: Busy wait n micro-seconds of virtual time */
+void Delay_Us(uint32 a_TimeInMicroSeconds)
+{
+    Sim_AdvanceTo(Sim_GetTime() + ((SIM_CYCLES_PER_MS / 1000ULL) * a_TimeInMicroSeconds));
+}
+
+/************************************************************************************/
+
+/* Description: Stop the SysTick Timer */
+void SysTick_Stop(void)
+{
+    g_SysTick_Next_Interrupt = SIM_TIMER_STOPPED;
+}
+
+/************************************************************************************/
+
+/* Description: Start/resume the SysTick Timer with a full period */
+void SysTick_Start(void)
+{
+    g_SysTick_Last_Interrupt = Sim_GetTime();
+    g_SysTick_Next_Interrupt = g_SysTick_Last_Interrupt + g_SysTick_Period;
+}
+
+/************************************************************************************/
+
+/* Description: Deinitialize the SysTick Timer */
+void SysTick_DeInit(void)
+{
+    g_SysTick_Next_Interrupt = SIM_TIMER_STOPPED;
+}
+
+/************************************************************************************/
+
+/* Description: Setup the SysTick Timer call back, it replaces the previous one */
+void SysTick_SetCallBack(void(*Ptr2Func)(void))
+{
+    SysTick_Unsubscribe(g_SysTick_Call_Back_Ptr);
+    g_SysTick_Call_Back_Ptr = Ptr2Func;
+    (void)SysTick_Subscribe(Ptr2Func, 1, GPT_SYSTICK_CALLBACK_PRIORITY);
+}
+
+/************************************************************************************/
+
+/* Description: Add a function to the SysTick interrupt in its priority order (same rules as the target driver) */
+Std_ReturnType SysTick_Subscribe(void (*Ptr2Func)(void), uint16 a_Divisor, uint8 a_Priority)
+{
+    uint8 index = 0;
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((NULL_PTR != Ptr2Func) && (a_Divisor > 0))
+    {
+        SysTick_Unsubscribe(Ptr2Func);
+        if(g_SysTick_Subscribers_Count < GPT_SYSTICK_MAX_SUBSCRIBERS)
+        {
+            index = g_SysTick_Subscribers_Count;
+            while((index > 0) && (g_SysTick_Subscribers[index - 1].Priority > a_Priority))
+            {
+                g_SysTick_Subscribers[index] = g_SysTick_Subscribers[index - 1];
+                index--;
+            }
+            g_SysTick_Subscribers[index].Callback_Ptr = Ptr2Func;
+            g_SysTick_Subscribers[index].Count        = 0;
+            g_SysTick_Subscribers[index].Divisor      = a_Divisor;
+            g_SysTick_Subscribers[index].Priority     = a_Priority;
+            g_SysTick_Subscribers_Count++;
+            ret = E_OK;
+        }
+    }
+    return ret;
+}
+
+/************************************************************************************/
+
+/* Description: Remove a function from the SysTick interrupt */
+void SysTick_Unsubscribe(void (*Ptr2Func)(void))
+{
+    uint8 index = 0;
+    boolean found = FALSE;
+
+    for(index = 0; (NULL_PTR != Ptr2Func) && (index < g_SysTick_Subscribers_Count); index++)
+    {
+        if(TRUE == found)
+        {
+            g_SysTick_Subscribers[index - 1] = g_SysTick_Subscribers[index];
+        }
+        else if(Ptr2Func == g_SysTick_Subscribers[index].Callback_Ptr)
+        {
+            found = TRUE;
+        }
+    }
+    if(TRUE == found)
+    {
+        g_SysTick_Subscribers_Count--;
+    }
+}
+
+/************************************************************************************/
+
+/* Description: The virtual clock is always counting */
+void Dwt_CycleCounterInit(void)
+{
+}
+
+/************************************************************************************/
+
+/* Description: Return the virtual time as the 32-bit DWT cycle counter */
+uint32 Sim_GetCycleCount(void)
+{
+    return (uint32)Sim_GetTime();
+}
+
+/************************************************************************************/
+
+/* Description: The virtual clock is the timestamp time base */
+void Gpt_TimestampInit(void)
+{
+}
+
+/************************************************************************************/
+
+/* Description: Return the virtual time as the 64-bit timestamp */
+Gpt_TimestampType Gpt_GetTimestamp(void)
+{
+    return (Gpt_TimestampType)Sim_GetTime();
+}
+
+/************************************************************************************/
+
+/* Description: Return the time of the next SysTick interrupt in CPU cycles, all ones if the timer is stopped */
+uint64 Sim_GptNextInterrupt(void)
+{
+    return g_SysTick_Next_Interrupt;
+}
+
+/************************************************************************************/
+
+/* Description: Run the SysTick interrupt due at the current virtual time and schedule the next one */
+void Sim_GptInterrupt(void)
+{
+    g_SysTick_Periods         = (uint16)((g_SysTick_Next_Interrupt - g_SysTick_Last_Interrupt) / g_SysTick_Period);
+    g_SysTick_Last_Interrupt  = g_SysTick_Next_Interrupt;
+    g_SysTick_Next_Interrupt += g_SysTick_Period;
+    g_SysTick_Interrupt_Count++;
+    SysTick_Handler();
+}
+
+/************************************************************************************/
+
+/* Description: Return the number of the simulated SysTick interrupts */
+uint64 Sim_GptInterruptCount(void)
+{
+    return g_SysTick_Interrupt_Count;
+}
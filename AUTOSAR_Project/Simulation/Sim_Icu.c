@@ -0,0 +1,139 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Icu.c
+ *
+ * Description: Host stand-in of the ICU Driver using virtual GPIO interrupt registers,
+ *              the edges of the inputs driven by the simulation raise the port interrupt.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "MCAL/ICU/Icu.h"
+#include "MCAL/IRQ/Irq.h"
+#include "Sim.h"
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* Virtual raw interrupt status and interrupt mask registers of each port */
+static uint8 g_Icu_Raw_Status[ICU_NUMBER_OF_PORTS];
+static uint8 g_Icu_Mask[ICU_NUMBER_OF_PORTS];
+
+/* Interrupt number of each port */
+static const Irq_NumberType g_Icu_Port_Irq[ICU_NUMBER_OF_PORTS] =
+{
+    GPIOA_IRQ_NUMBER, GPIOB_IRQ_NUMBER, GPIOC_IRQ_NUMBER,
+    GPIOD_IRQ_NUMBER, GPIOE_IRQ_NUMBER, GPIOF_IRQ_NUMBER
+};
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Sim_IcuPortHandler(uint8 Port);
+
+static void Sim_IcuPortA_Handler(void) { Sim_IcuPortHandler(0U); }
+static void Sim_IcuPortB_Handler(void) { Sim_IcuPortHandler(1U); }
+static void Sim_IcuPortC_Handler(void) { Sim_IcuPortHandler(2U); }
+static void Sim_IcuPortD_Handler(void) { Sim_IcuPortHandler(3U); }
+static void Sim_IcuPortE_Handler(void) { Sim_IcuPortHandler(4U); }
+static void Sim_IcuPortF_Handler(void) { Sim_IcuPortHandler(5U); }
+
+static const Irq_HandlerType g_Icu_Port_Handler[ICU_NUMBER_OF_PORTS] =
+{
+    Sim_IcuPortA_Handler, Sim_IcuPortB_Handler, Sim_IcuPortC_Handler,
+    Sim_IcuPortD_Handler, Sim_IcuPortE_Handler, Sim_IcuPortF_Handler
+};
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: Mask the channels and install the handlers of their ports */
+void Icu_Init(void)
+{
+    const Icu_ChannelConfigType * Config_Ptr = NULL_PTR;
+    Icu_ChannelType Channel = 0;
+
+    for(Channel = 0; Channel < ICU_NUMBER_OF_CHANNELS; Channel++)
+    {
+        Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+        g_Icu_Mask[Config_Ptr->Port_Num]       &= (uint8)~Config_Ptr->Pins_Mask;
+        g_Icu_Raw_Status[Config_Ptr->Port_Num] &= (uint8)~Config_Ptr->Pins_Mask;
+        (void)Irq_InstallHandler(IRQ_PERIPHERAL_VECTOR(g_Icu_Port_Irq[Config_Ptr->Port_Num]),
+                                 g_Icu_Port_Handler[Config_Ptr->Port_Num]);
+        Irq_EnableInterrupt(g_Icu_Port_Irq[Config_Ptr->Port_Num]);
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Clear the latched edges of the channel and unmask it */
+void Icu_EnableNotification(Icu_ChannelType Channel)
+{
+    const Icu_ChannelConfigType * Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+
+    g_Icu_Raw_Status[Config_Ptr->Port_Num] &= (uint8)~Config_Ptr->Pins_Mask;
+    g_Icu_Mask[Config_Ptr->Port_Num]       |= Config_Ptr->Pins_Mask;
+}
+
+/************************************************************************************/
+
+/* Description: Mask the channel, its edges are still latched */
+void Icu_DisableNotification(Icu_ChannelType Channel)
+{
+    const Icu_ChannelConfigType * Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+
+    g_Icu_Mask[Config_Ptr->Port_Num] &= (uint8)~Config_Ptr->Pins_Mask;
+}
+
+/************************************************************************************/
+
+/* Description: Latch the edge of an input pin in the channels detecting it and raise the port interrupt if it is unmasked */
+void Sim_IcuInputChanged(uint8 Port, uint8 Pin, uint8 Level)
+{
+    const Icu_ChannelConfigType * Config_Ptr = NULL_PTR;
+    Icu_ChannelType Channel = 0;
+    uint8 pin_mask = (uint8)(1U << Pin);
+
+    for(Channel = 0; Channel < ICU_NUMBER_OF_CHANNELS; Channel++)
+    {
+        Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+        if((Port == Config_Ptr->Port_Num) && (0 != (pin_mask & Config_Ptr->Pins_Mask))
+           && ((ICU_BOTH_EDGES == Config_Ptr->Activation)
+               || ((ICU_RISING_EDGE == Config_Ptr->Activation) && (STD_HIGH == Level))
+               || ((ICU_FALLING_EDGE == Config_Ptr->Activation) && (STD_LOW == Level))))
+        {
+            g_Icu_Raw_Status[Port] |= pin_mask;
+        }
+    }
+
+    if(0 != (g_Icu_Raw_Status[Port] & g_Icu_Mask[Port]))
+    {
+        Sim_IrqRaise(g_Icu_Port_Irq[Port]);
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Clear the masked edges of a port and call the notifications of their channels as the ICU Driver does */
+static void Sim_IcuPortHandler(uint8 Port)
+{
+    const Icu_ChannelConfigType * Config_Ptr = NULL_PTR;
+    Icu_ChannelType Channel = 0;
+    uint8 status = g_Icu_Raw_Status[Port] & g_Icu_Mask[Port];
+
+    g_Icu_Raw_Status[Port] &= (uint8)~status;
+    for(Channel = 0; Channel < ICU_NUMBER_OF_CHANNELS; Channel++)
+    {
+        Config_Ptr = &Icu_ChannelsConfigurations[Channel];
+        if((Port == Config_Ptr->Port_Num) && (0 != (status & Config_Ptr->Pins_Mask))
+           && (NULL_PTR != Config_Ptr->Notification_Ptr))
+        {
+            Config_Ptr->Notification_Ptr();
+        }
+    }
+}
@@ -0,0 +1,94 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Irq.c
+ *
+ * Description: Host stand-in of the Interrupt Manager, the installed handlers are called
+ *              by the simulation when it raises a peripheral interrupt.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "MCAL/IRQ/Irq.h"
+#include "Sim.h"
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* The installed handlers indexed by the vector number */
+static Irq_HandlerType g_Irq_Vectors[IRQ_NUMBER_OF_VECTORS];
+
+/* Enable state of each peripheral interrupt */
+static boolean g_Irq_Enabled[IRQ_NUMBER_OF_VECTORS];
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: No vector table on the host, the handlers start empty */
+void Irq_Init(void)
+{
+}
+
+/************************************************************************************/
+
+/* Description: Store the handler of a vector */
+Std_ReturnType Irq_InstallHandler(Irq_VectorType Vector, Irq_HandlerType Handler)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if((Vector > 1) && (Vector < IRQ_NUMBER_OF_VECTORS) && (NULL_PTR != Handler))
+    {
+        g_Irq_Vectors[Vector] = Handler;
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/************************************************************************************/
+
+/* Description: Enable a peripheral interrupt */
+void Irq_EnableInterrupt(Irq_NumberType IrqNumber)
+{
+    g_Irq_Enabled[IRQ_PERIPHERAL_VECTOR(IrqNumber)] = TRUE;
+}
+
+/************************************************************************************/
+
+/* Description: Disable a peripheral interrupt */
+void Irq_DisableInterrupt(Irq_NumberType IrqNumber)
+{
+    g_Irq_Enabled[IRQ_PERIPHERAL_VECTOR(IrqNumber)] = FALSE;
+}
+
+/************************************************************************************/
+
+/* Description: The pending interrupt runs at once as the host has no interrupt priorities */
+void Irq_SetPending(Irq_NumberType IrqNumber)
+{
+    Sim_IrqRaise(IrqNumber);
+}
+
+/************************************************************************************/
+
+/* Description: No priorities on the host, the interrupts run one at a time */
+void Irq_SetPriority(Irq_NumberType IrqNumber, uint8 Priority)
+{
+    (void)IrqNumber;
+    (void)Priority;
+}
+
+/************************************************************************************/
+
+/* Description: Run the installed handler of a peripheral interrupt if it is enabled */
+void Sim_IrqRaise(Irq_NumberType IrqNumber)
+{
+    Irq_VectorType Vector = IRQ_PERIPHERAL_VECTOR(IrqNumber);
+
+    if((TRUE == g_Irq_Enabled[Vector]) && (NULL_PTR != g_Irq_Vectors[Vector]))
+    {
+        g_Irq_Vectors[Vector]();
+    }
+}
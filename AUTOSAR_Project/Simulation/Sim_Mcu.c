@@ -0,0 +1,17 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Mcu.c
+ *
+ * Description: Host stand-in of the MCU Driver, the virtual clock needs no clock gating.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "MCAL/MCU/Mcu.h"
+
+/* Description: Nothing to enable on the host */
+void Mcu_Init(void)
+{
+}
@@ -0,0 +1,62 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Port.c
+ *
+ * Description: Host stand-in of the PORT Driver, the pins of the virtual ports need no configuration,
+ *              only the modes set at run time are kept.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "MCAL/Port/Port.h"
+#include "Sim.h"
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* Mode of each pin set by Port_SetPinMode, all the pins start in the mode 0 (Dio) */
+static Port_PinModeType g_Port_Pin_Mode[NUMBER_OF_PORT_PINS];
+
+/* Number of the pin mode changes */
+static uint32 g_Port_Mode_Changes = 0;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: Nothing to configure on the host, the Dio stand-in keeps the pin levels */
+void Port_Init(const Port_ConfigType * ConfigPtr)
+{
+    (void)ConfigPtr;
+}
+
+/************************************************************************************/
+
+/* Description: Keep the mode of the pin and count the mode changes */
+void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+{
+    if((Pin < NUMBER_OF_PORT_PINS) && (Mode != g_Port_Pin_Mode[Pin]))
+    {
+        g_Port_Pin_Mode[Pin] = Mode;
+        g_Port_Mode_Changes++;
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Return the mode of a pin */
+uint8 Sim_PortGetPinMode(uint8 Pin)
+{
+    return g_Port_Pin_Mode[Pin];
+}
+
+/************************************************************************************/
+
+/* Description: Return the number of the pin mode changes */
+uint32 Sim_PortGetModeChangeCount(void)
+{
+    return g_Port_Mode_Changes;
+}
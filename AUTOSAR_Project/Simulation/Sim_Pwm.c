@@ -0,0 +1,107 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Pwm.c
+ *
+ * Description: Host stand-in of the PWM Driver, the staged duty cycles are applied by Pwm_ApplyUpdates
+ *              (the end of the period is not simulated).
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include "MCAL/PWM/Pwm.h"
+#include "Sim.h"
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+/* Staged and applied duty cycle of each channel */
+static uint16 g_Pwm_Staged_Duty[PWM_NUMBER_OF_CHANNELS];
+static uint16 g_Pwm_Applied_Duty[PWM_NUMBER_OF_CHANNELS];
+
+/* Number of the Pwm_ApplyUpdates calls with staged updates */
+static uint32 g_Pwm_Updates = 0;
+static boolean g_Pwm_Staged = FALSE;
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: Start the channels with their configured duty cycles */
+void Pwm_Init(void)
+{
+    Pwm_ChannelType Channel = 0;
+
+    for(Channel = 0; Channel < PWM_NUMBER_OF_CHANNELS; Channel++)
+    {
+        g_Pwm_Staged_Duty[Channel]  = Pwm_ChannelsConfigurations[Channel].Duty_Cycle;
+        g_Pwm_Applied_Duty[Channel] = Pwm_ChannelsConfigurations[Channel].Duty_Cycle;
+    }
+    g_Pwm_Staged = FALSE;
+}
+
+/************************************************************************************/
+
+/* Description: Stage and apply the duty cycle of a channel */
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    Pwm_StageDutyCycle(ChannelNumber, DutyCycle);
+    Pwm_ApplyUpdates();
+}
+
+/************************************************************************************/
+
+/* Description: The period is not simulated, only the duty cycle is set */
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16 DutyCycle)
+{
+    (void)Period;
+    Pwm_SetDutyCycle(ChannelNumber, DutyCycle);
+}
+
+/************************************************************************************/
+
+/* Description: Keep the duty cycle of a channel until Pwm_ApplyUpdates */
+void Pwm_StageDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    if(ChannelNumber < PWM_NUMBER_OF_CHANNELS)
+    {
+        g_Pwm_Staged_Duty[ChannelNumber] = DutyCycle;
+        g_Pwm_Staged = TRUE;
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Apply the staged duty cycles of all the channels together */
+void Pwm_ApplyUpdates(void)
+{
+    Pwm_ChannelType Channel = 0;
+
+    if(TRUE == g_Pwm_Staged)
+    {
+        for(Channel = 0; Channel < PWM_NUMBER_OF_CHANNELS; Channel++)
+        {
+            g_Pwm_Applied_Duty[Channel] = g_Pwm_Staged_Duty[Channel];
+        }
+        g_Pwm_Staged = FALSE;
+        g_Pwm_Updates++;
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Return the applied duty cycle of a channel */
+uint16 Sim_PwmGetDutyCycle(uint8 ChannelNumber)
+{
+    return g_Pwm_Applied_Duty[ChannelNumber];
+}
+
+/************************************************************************************/
+
+/* Description: Return the number of the applied PWM updates */
+uint32 Sim_PwmGetUpdateCount(void)
+{
+    return g_Pwm_Updates;
+}
@@ -0,0 +1,148 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Sim_Uart.c
+ *
+ * Description: Host stand-in of the UART Driver. The ring buffer drains at UART_BAUD_RATE
+ *              (10 bits per byte) in virtual time, so the frames are dropped as on the target
+ *              when the trace produces more than the line can carry. The sent bytes are
+ *              written to the capture file given by the -u option of the simulation.
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "MCAL/UART/Uart.h"
+#include "Sim.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* CPU cycles on the line per byte: start bit, 8 data bits and stop bit */
+#define SIM_UART_CYCLES_PER_BYTE        ((10ULL * SIM_CPU_CLOCK_HZ) / UART_BAUD_RATE)
+
+#define SIM_UART_INDEX_MASK             (UART_TX_BUFFER_SIZE - 1U)
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+static boolean g_Uart_Initialized = FALSE;
+
+static uint8 g_Uart_Tx_Buffer[UART_TX_BUFFER_SIZE];
+static uint16 g_Uart_Tx_Head = 0;
+static uint16 g_Uart_Tx_Tail = 0;
+
+/* Virtual time at which the byte at the tail is on the line */
+static uint64 g_Uart_Line_Time = 0;
+
+static uint64 g_Uart_Sent_Count = 0;
+static FILE * g_Uart_Capture = NULL;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static void Sim_UartDrain(void);
+
+/*******************************************************************************
+ *                          Functions Definitions                              *
+ *******************************************************************************/
+
+/* Description: Start with an empty ring buffer */
+void Uart_Init(void)
+{
+    g_Uart_Tx_Head = 0;
+    g_Uart_Tx_Tail = 0;
+    g_Uart_Initialized = TRUE;
+}
+
+/************************************************************************************/
+
+/* Description: Queue the bytes if they all fit after the bytes already sent in virtual time are removed */
+Std_ReturnType Uart_Transmit(const uint8 * Data_Ptr, uint16 Length)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 index = 0;
+
+    if((TRUE == g_Uart_Initialized) && (NULL_PTR != Data_Ptr) && (Length <= Uart_GetTxFree()))
+    {
+        if(g_Uart_Tx_Head == g_Uart_Tx_Tail)
+        {
+            /* The line is idle, the first byte starts now */
+            g_Uart_Line_Time = Sim_GetTime();
+        }
+        for(index = 0; index < Length; index++)
+        {
+            g_Uart_Tx_Buffer[g_Uart_Tx_Head & SIM_UART_INDEX_MASK] = Data_Ptr[index];
+            g_Uart_Tx_Head++;
+        }
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/************************************************************************************/
+
+/* Description: Return the room left after the bytes already sent in virtual time are removed */
+uint16 Uart_GetTxFree(void)
+{
+    Sim_UartDrain();
+    return (uint16)(UART_TX_BUFFER_SIZE - (uint16)(g_Uart_Tx_Head - g_Uart_Tx_Tail));
+}
+
+/************************************************************************************/
+
+/* Description: Write the sent bytes to this capture file (binary), it is closed by Sim_UartClose */
+void Sim_UartOpen(const char * FileName)
+{
+    g_Uart_Capture = fopen(FileName, "wb");
+    if(NULL == g_Uart_Capture)
+    {
+        fprintf(stderr, "can not open the UART capture file %s\n", FileName);
+    }
+}
+
+/************************************************************************************/
+
+/* Description: Send the bytes left in the ring buffer, close the capture file and return the number of the sent bytes */
+uint64 Sim_UartClose(void)
+{
+    while(g_Uart_Tx_Tail != g_Uart_Tx_Head)
+    {
+        if(NULL != g_Uart_Capture)
+        {
+            (void)fputc(g_Uart_Tx_Buffer[g_Uart_Tx_Tail & SIM_UART_INDEX_MASK], g_Uart_Capture);
+        }
+        g_Uart_Tx_Tail++;
+        g_Uart_Sent_Count++;
+    }
+    if(NULL != g_Uart_Capture)
+    {
+        (void)fclose(g_Uart_Capture);
+        g_Uart_Capture = NULL;
+    }
+    return g_Uart_Sent_Count;
+}
+
+/************************************************************************************/
+
+/* Description: Remove the bytes whose transmission is over at the current virtual time */
+static void Sim_UartDrain(void)
+{
+    uint64 now = Sim_GetTime();
+
+    while((g_Uart_Tx_Tail != g_Uart_Tx_Head) && ((g_Uart_Line_Time + SIM_UART_CYCLES_PER_BYTE) <= now))
+    {
+        if(NULL != g_Uart_Capture)
+        {
+            (void)fputc(g_Uart_Tx_Buffer[g_Uart_Tx_Tail & SIM_UART_INDEX_MASK], g_Uart_Capture);
+        }
+        g_Uart_Tx_Tail++;
+        g_Uart_Sent_Count++;
+        g_Uart_Line_Time += SIM_UART_CYCLES_PER_BYTE;
+    }
+}
@@ -0,0 +1,245 @@
+ /******************************************************************************
+ *
+ * Module: Simulation
+ *
+ * File Name: Trace_Decode.c
+ *
+ * Description: Host decoder of the binary UART0 trace stream (Services_Layer/Trace), it prints
+ *              one line per frame with the module and event names. The input is a capture of
+ *              the serial port or the capture file of the simulation (-u option).
+ *              The 32-bit timestamps are extended assuming at least one frame every 2^32 cycles
+ *              (268 s at 16 MHz), a gap longer than that shifts the following times.
+ *              Bytes that do not form a valid frame (capture started mid-frame, line noise)
+ *              are skipped until the next sync byte with a valid checksum.
+ *
+ *              Build (from the AUTOSAR_Project folder):
+ *                gcc -std=c99 -O2 -DHOST_SIM -I. -o trace_decode Simulation/Trace_Decode.c
+ *
+ *              Run:
+ *                ./trace_decode [capture_file]     (the standard input if no file is given)
+ *
+ * Author: Bassam Ashraf
+ ******************************************************************************/
+
+#include <stdio.h>
+
+#include "Services_Layer/Trace/Trace.h"
+#include "MCAL/GPT/Gpt_Cfg.h"
+
+/*******************************************************************************
+ *                             PreProcessor Macros                             *
+ *******************************************************************************/
+
+/* Module IDs of the modules reporting to the Det (the *_MODULE_ID of each module) */
+#define DECODE_DET_MODULE_ID            (15U)
+#define DECODE_DIO_MODULE_ID            (120U)
+#define DECODE_PORT_MODULE_ID           (125U)
+
+/* Longest frame */
+#define DECODE_MAX_FRAME_SIZE           (TRACE_DET_FRAME_SIZE)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Name of an ID */
+typedef struct
+{
+    uint16 Id;
+    const char * Name;
+}Decode_NameType;
+
+/*******************************************************************************
+ *                             Global Variables                                *
+ *******************************************************************************/
+
+static const Decode_NameType g_Module_Names[] =
+{
+    { DECODE_DET_MODULE_ID,  "DET"  },
+    { DECODE_DIO_MODULE_ID,  "DIO"  },
+    { DECODE_PORT_MODULE_ID, "PORT" }
+};
+
+static const Decode_NameType g_Event_Names[] =
+{
+    { TraceConf_OS_OVERRUN_EVENT_ID, "OS_OVERRUN" }
+};
+
+/* The extended timestamp of the last frame */
+static uint64 g_Timestamp = 0;
+
+/*******************************************************************************
+ *                      Private Function Prototypes                            *
+ *******************************************************************************/
+
+static uint8 Decode_FrameSize(uint8 Type);
+
+static const char * Decode_Name(const Decode_NameType * Names, uint32 Count, uint16 Id);
+
+static double Decode_Time(const uint8 * Frame_Ptr);
+
+/*******************************************************************************
+ *                          Function definitions                               *
+ *******************************************************************************/
+
+int main(int argc, char * argv[])
+{
+    FILE * file = stdin;
+    uint8 frame[DECODE_MAX_FRAME_SIZE];
+    uint8 length = 0;       /* Bytes in frame[] */
+    uint8 size = 0;
+    uint8 checksum = 0;
+    uint8 index = 0;
+    int byte = 0;
+    unsigned long frames = 0, dropped = 0, skipped = 0;
+    const char * name = NULL;
+
+    if(argc > 2)
+    {
+        fprintf(stderr, "usage: %s [capture_file]\n", argv[0]);
+        return 2;
+    }
+    if(argc == 2)
+    {
+        file = fopen(argv[1], "rb");
+        if(NULL == file)
+        {
+            fprintf(stderr, "can not open the capture file %s\n", argv[1]);
+            return 2;
+        }
+    }
+
+    while(EOF != (byte = fgetc(file)))
+    {
+        frame[length++] = (uint8)byte;
+
+        /* Wait for the sync byte, then for the type, then for the whole frame */
+        if(TRACE_SYNC_BYTE != frame[0])
+        {
+            length = 0;
+            skipped++;
+            continue;
+        }
+        if(length < 2)
+        {
+            continue;
+        }
+        size = Decode_FrameSize(frame[1]);
+        if((0 != size) && (length < size))
+        {
+            continue;
+        }
+
+        checksum = 0;
+        for(index = 1; index < size; index++)
+        {
+            checksum += frame[index];
+        }
+        if((0 == size) || (0 != checksum))
+        {
+            /* Not a frame, restart the search from the byte after this sync byte */
+            skipped++;
+            for(index = 1; index < length; index++)
+            {
+                frame[index - 1] = frame[index];
+            }
+            length--;
+            while((length > 0) && (TRACE_SYNC_BYTE != frame[0]))
+            {
+                for(index = 1; index < length; index++)
+                {
+                    frame[index - 1] = frame[index];
+                }
+                length--;
+                skipped++;
+            }
+            continue;
+        }
+
+        frames++;
+        switch(frame[1])
+        {
+        case TRACE_FRAME_DET:
+            name = Decode_Name(g_Module_Names, sizeof(g_Module_Names) / sizeof(g_Module_Names[0]),
+                               (uint16)(frame[6] | (frame[7] << 8)));
+            printf("%14.6f DET      module %s instance %u api %u error %u\n", Decode_Time(frame), name,
+                   (unsigned)frame[8], (unsigned)frame[9], (unsigned)frame[10]);
+            break;
+        case TRACE_FRAME_EVENT:
+            name = Decode_Name(g_Event_Names, sizeof(g_Event_Names) / sizeof(g_Event_Names[0]), frame[6]);
+            printf("%14.6f EVENT    %s value %u\n", Decode_Time(frame), name, (unsigned)(frame[7] | (frame[8] << 8)));
+            break;
+        default:
+            dropped += (unsigned long)(frame[6] | (frame[7] << 8));
+            printf("%14.6f OVERFLOW %u frames dropped before this point\n", Decode_Time(frame),
+                   (unsigned)(frame[6] | (frame[7] << 8)));
+            break;
+        }
+        length = 0;
+    }
+
+    if(stdin != file)
+    {
+        fclose(file);
+    }
+    fprintf(stderr, "%lu frames, %lu frames dropped by the target, %lu bytes skipped\n", frames, dropped, skipped + length);
+    return 0;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the size of a frame type, 0 for an unknown type */
+static uint8 Decode_FrameSize(uint8 Type)
+{
+    uint8 size = 0;
+
+    switch(Type)
+    {
+    case TRACE_FRAME_DET:
+        size = TRACE_DET_FRAME_SIZE;
+        break;
+    case TRACE_FRAME_EVENT:
+        size = TRACE_EVENT_FRAME_SIZE;
+        break;
+    case TRACE_FRAME_OVERFLOW:
+        size = TRACE_OVERFLOW_FRAME_SIZE;
+        break;
+    default:
+        break;
+    }
+    return size;
+}
+
+/*********************************************************************************************/
+
+/* Description: Return the name of an ID, or the ID as a number */
+static const char * Decode_Name(const Decode_NameType * Names, uint32 Count, uint16 Id)
+{
+    static char number[8];
+    uint32 index = 0;
+
+    for(index = 0; index < Count; index++)
+    {
+        if(Id == Names[index].Id)
+        {
+            return Names[index].Name;
+        }
+    }
+    snprintf(number, sizeof(number), "%u", (unsigned)Id);
+    return number;
+}
+
+/*********************************************************************************************/
+
+/* Description: Extend the 32-bit timestamp of a frame and return it in seconds */
+static double Decode_Time(const uint8 * Frame_Ptr)
+{
+    uint32 low = (uint32)Frame_Ptr[2] | ((uint32)Frame_Ptr[3] << 8) | ((uint32)Frame_Ptr[4] << 16) | ((uint32)Frame_Ptr[5] << 24);
+
+    if(low < (uint32)g_Timestamp)
+    {
+        g_Timestamp += 0x100000000ULL;
+    }
+    g_Timestamp = (g_Timestamp & 0xFFFFFFFF00000000ULL) | low;
+    return (double)g_Timestamp / GPT_CPU_CLOCK_HZ;
+}
@@ -35,6 +35,11 @@ SECTIONS
     .pinit  :   > FLASH
     .init_array : > FLASH
 
+    /* The FUNC_RAM functions are stored in the FLASH and copied to the SRAM by ResetISR,     */
+    /* palign(4) word aligns both addresses and pads the size to whole words for that copy   */
+    .TI.ramfunc : load = FLASH, run = SRAM, palign(4),
+                  LOAD_START(__ramfunc_load_start), RUN_START(__ramfunc_run_start), SIZE(__ramfunc_size)
+
     .vtable :   > 0x20000000
     .data   :   > SRAM
     .bss    :   > SRAM
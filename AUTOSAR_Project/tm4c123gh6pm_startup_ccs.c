@@ -34,6 +34,7 @@ static void NmiSR(void);
 static void FaultISR(void);
 static void IntDefaultHandler(void);
 extern void SysTick_Handler(void);
+extern void PendSV_Handler(void);
 
 //*****************************************************************************
 //
@@ -50,6 +51,16 @@ extern void _c_int00(void);
 //*****************************************************************************
 extern uint32_t __STACK_TOP;
 
+//*****************************************************************************
+//
+// Linker variables that mark the load (flash) and run (SRAM) addresses and
+// the size of the .TI.ramfunc section (FUNC_RAM functions).
+//
+//*****************************************************************************
+extern uint32_t __ramfunc_load_start;
+extern uint32_t __ramfunc_run_start;
+extern uint32_t __ramfunc_size;
+
 //*****************************************************************************
 //
 // External declarations for the interrupt handlers used by the application.
@@ -82,7 +93,7 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // SVCall handler
     IntDefaultHandler,                      // Debug monitor handler
     0,                                      // Reserved
-    IntDefaultHandler,                      // The PendSV handler
+    PendSV_Handler,                         // The PendSV handler
     SysTick_Handler,                        // The SysTick handler
     IntDefaultHandler,                      // GPIO Port A
     IntDefaultHandler,                      // GPIO Port B
@@ -238,6 +249,22 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    uint32_t *pui32Src = &__ramfunc_load_start;
+    uint32_t *pui32Dest = &__ramfunc_run_start;
+    uint32_t *pui32End = (uint32_t *)((uint32_t)&__ramfunc_run_start +
+                                      (uint32_t)&__ramfunc_size);
+
+    //
+    // Copy the FUNC_RAM functions from the flash to the SRAM before any of
+    // them is called, the C initialization does not touch this section.  The
+    // linker command file places it with palign(4), so both addresses are
+    // word aligned and the size is a whole number of words.
+    //
+    while(pui32Dest < pui32End)
+    {
+        *pui32Dest++ = *pui32Src++;
+    }
+
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.